@@ -0,0 +1,198 @@
+#ifndef BACKTESTER_H
+#define BACKTESTER_H
+
+#include "TechnicalIndicators.h"
+#include "RiskManager.h"
+#include "Strategy.h"
+#include "Span.h"
+#include "FillModel.h"
+#include "BarIndex.h"
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <ostream>
+
+namespace yuanta {
+
+class ThreadPool;
+
+// 백테스트 결과 구조체
+struct BacktestResult {
+    double totalReturn = 0.0;
+    double annualizedReturn = 0.0;
+    double maxDrawdown = 0.0;
+    double sharpeRatio = 0.0;
+    double winRate = 0.0;
+    double profitFactor = 0.0;
+    int totalTrades = 0;
+    int winTrades = 0;
+    int lossTrades = 0;
+    double avgWin = 0.0;
+    double avgLoss = 0.0;
+    double avgHoldingPeriod = 0.0;  // 분 단위
+};
+
+// 백테스트 거래 기록
+struct BacktestTrade {
+    std::string code;
+    long long entryTime;
+    long long exitTime;
+    double entryPrice;
+    double exitPrice;
+    int quantity;
+    double pnl;
+    double pnlPercent;
+    std::string strategy;
+    std::string exitReason;
+};
+
+// 병렬 실행 단위: 한 전략을 한 종목 묶음에 대해 실행
+struct BacktestJob {
+    std::string strategyName;
+    std::vector<std::string> codes;     // 비어 있으면 로드된 전 종목
+    std::map<std::string, double> parameters;   // 전략 파라미터 (setParameter로 적용)
+
+    // 구간 (거래일 단위, 봉 시각의 KST 일자 기준). dayCount가 0이면 끝까지
+    // 구간 앞 최대 warmupDays일은 지표 준비용으로만 쓰고 매매하지 않는다.
+    size_t firstDay = 0;
+    size_t dayCount = 0;
+    size_t warmupDays = 1;
+};
+
+// 병렬 실행 결과 (제출 순서대로 반환)
+struct BacktestJobResult {
+    BacktestJob job;
+    BacktestResult result;
+    std::vector<BacktestTrade> trades;
+    std::vector<std::pair<long long, double>> equityCurve;
+    std::string log;                    // 실행 중 출력 (작업별로 모아 둠)
+};
+
+// 종목코드 → 시각순 1분봉
+using BarHistory = std::map<std::string, std::vector<OHLCV>>;
+
+// 백테스터 클래스
+class Backtester {
+public:
+    Backtester();
+
+    // 데이터 로드
+    bool loadData(const std::string& filepath, const std::string& code);
+
+    // 바이너리 봉 파일(.ybar)의 전 종목 로드 (파싱 없이 컬럼에서 바로 변환)
+    bool loadBinary(const std::string& filepath);
+
+    // 시뮬레이션 데이터 생성
+    void generateSimulatedData(const std::string& code, int days = 180);
+
+    // 다른 백테스터가 로드한 데이터를 복사 없이 공유 (읽기 전용으로 사용)
+    void shareHistory(const Backtester& source);
+    const BarHistory& getHistory() const { return *history; }
+
+    // 전략 생성 (알 수 없는 이름이면 nullptr)
+    static std::unique_ptr<Strategy> createStrategy(const std::string& strategyName);
+
+    // 백테스트 실행 (codes가 비어 있으면 전 종목, parameters는 전략 기본값 대신 적용)
+    BacktestResult run(const std::string& strategyName,
+                       const std::vector<std::string>& codes = {},
+                       const std::map<std::string, double>& parameters = {});
+
+    // 작업 단위 실행 (구간 지정 시 이력을 복사하지 않고 잘라서 사용)
+    BacktestResult run(const BacktestJob& job);
+
+    // 대상 종목 공통 거래일 수 (codes가 비어 있으면 전 종목)
+    size_t tradingDays(const std::vector<std::string>& codes = {}) const;
+
+    // 거래 기록과 자산 곡선으로 결과 계산 (구간별 결과를 이어 붙일 때 사용)
+    static BacktestResult summarize(const std::vector<BacktestTrade>& trades,
+                                    const std::vector<std::pair<long long, double>>& equityCurve);
+
+    static constexpr size_t BARS_PER_DAY = 390;             // 시뮬레이션 데이터의 하루 분봉 수 (9:00~15:30)
+    static constexpr double INITIAL_CASH = 10000000.0;
+
+    // 작업들을 스레드 풀에서 병렬 실행
+    // 작업마다 별도 백테스터(전략/리스크 매니저/계좌 상태)를 만들고 이력 데이터만 공유한다.
+    // 결과는 완료 순서와 무관하게 jobs 순서로 반환된다.
+    std::vector<BacktestJobResult> runParallel(const std::vector<BacktestJob>& jobs,
+                                               ThreadPool& pool) const;
+
+    // 거래 기록 조회
+    const std::vector<BacktestTrade>& getTrades() const {
+        return trades;
+    }
+
+    // 일별 자산 곡선 조회
+    const std::vector<std::pair<long long, double>>& getEquityCurve() const {
+        return equityCurve;
+    }
+
+    // 진행 상황 출력 대상 (기본 std::cout)
+    void setLog(std::ostream* out) { log = out; }
+
+    // 지표 계산 방식 (기본: 전략이 선언한 지표를 종목당 한 번 전 구간 계산)
+    // false면 이전 방식대로 매 봉 lookback 구간에서 다시 계산한다 (결과 비교용).
+    void setPrecomputeIndicators(bool enabled) { precomputeIndicators = enabled; }
+    bool getPrecomputeIndicators() const { return precomputeIndicators; }
+
+    // 리스크 한도 (실거래와 같은 RiskManager 규칙: 종목당/총 투자 한도, 일일 손실 한도, 동시 보유 수)
+    void setRiskConfig(const DailyBudgetConfig& riskConfig) { config = riskConfig; }
+    const DailyBudgetConfig& getRiskConfig() const { return config; }
+
+    // 체결 모델 (기본: 봉 고가/저가 기준 IntrabarFillModel, 병렬 작업들이 공유)
+    void setFillModel(std::shared_ptr<const FillModel> model) { fillModel = std::move(model); }
+    std::shared_ptr<const FillModel> getFillModel() const { return fillModel; }
+
+private:
+    DailyBudgetConfig config;
+    std::shared_ptr<const FillModel> fillModel;
+    double commission;
+    double tax;
+
+    // 이력 데이터 (shareHistory로 여러 백테스터가 공유)
+    std::shared_ptr<BarHistory> history;
+
+    std::vector<BacktestTrade> trades;
+    std::vector<std::pair<long long, double>> equityCurve;
+    std::ostream* log;
+    bool precomputeIndicators = true;
+
+    // 보유 포지션
+    struct SimPosition {
+        std::string code;
+        int quantity;
+        double entryPrice;
+        long long entryTime;
+        double stopLoss;
+        double takeProfit1;
+        double takeProfit2;
+        std::string strategy;
+    };
+
+    // 포트폴리오 시뮬레이션 대상 종목 (구간 뷰와 종목별 미리 계산한 컬럼)
+    struct SimSymbol {
+        std::string code;
+        SymbolId symbolId = INVALID_SYMBOL_ID;  // 매 봉 컨텍스트에 넘김 (레지스트리 조회는 종목당 한 번)
+        Span<OHLCV> candles;            // candles[0]은 하루의 첫 봉
+        size_t tradeStart = 0;          // 이 위치부터 매매 (앞쪽은 워밍업)
+        DayIndex days;                  // candles의 거래일 구간
+        std::vector<double> closes;
+        IndicatorColumns columns;
+    };
+
+    double cash = INITIAL_CASH;
+    double peakEquity = INITIAL_CASH;
+    double maxDrawdown = 0.0;
+
+    // 전 종목의 봉을 시각순으로 병합해 하나의 계좌로 시뮬레이션
+    void simulatePortfolio(Strategy* strategy, RiskManager& rm,
+                           std::vector<SimSymbol>& symbols);
+    // fillPrice는 체결 모델이 정한 최종 매도 체결가
+    void closeTrade(const SimPosition& pos, double fillPrice, long long exitTime,
+                    const std::string& reason);
+    void calculateResults(BacktestResult& result);
+};
+
+} // namespace yuanta
+
+#endif // BACKTESTER_H
@@ -0,0 +1,103 @@
+#ifndef BAR_FILE_H
+#define BAR_FILE_H
+
+#include "TechnicalIndicators.h"
+#include "MappedFile.h"
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstdint>
+
+namespace yuanta {
+
+// 바이너리 컬럼형 봉 파일 (.ybar, 리틀 엔디언, 8바이트 정렬)
+//
+//   [헤더 32B] magic "YBAR", version, symbolCount, indexOffset, totalBars
+//   [종목별 컬럼] timestamp[n] open[n] high[n] low[n] close[n] volume[n]
+//   [인덱스 64B x symbolCount] 종목코드, 봉 개수, 컬럼 시작 위치, 첫/마지막 시각
+//
+// 읽기는 파일을 메모리 맵한 뒤 컬럼 포인터를 그대로 넘기므로 파싱과 복사가 없다.
+const uint32_t BAR_FILE_VERSION = 1;
+
+#pragma pack(push, 1)
+struct BarFileHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t symbolCount;
+    uint32_t reserved;
+    uint64_t indexOffset;
+    uint64_t totalBars;
+};
+
+struct BarFileIndexEntry {
+    char code[16];
+    uint64_t barCount;
+    uint64_t dataOffset;
+    int64_t firstTimestamp;
+    int64_t lastTimestamp;
+    uint64_t reserved[2];
+};
+#pragma pack(pop)
+
+static_assert(sizeof(BarFileHeader) == 32, "BarFileHeader layout");
+static_assert(sizeof(BarFileIndexEntry) == 64, "BarFileIndexEntry layout");
+
+// 한 종목의 컬럼 뷰 (BarFileReader가 열려 있는 동안만 유효)
+struct BarSeriesView {
+    std::string code;
+    size_t count = 0;
+    const long long* timestamp = nullptr;
+    const double* open = nullptr;
+    const double* high = nullptr;
+    const double* low = nullptr;
+    const double* close = nullptr;
+    const long long* volume = nullptr;
+
+    OHLCV at(size_t i) const;
+
+    // 최근 n개 봉을 OHLCV로 변환해 out 뒤에 추가 (n이 count보다 크면 전체)
+    void appendTo(std::vector<OHLCV>& out, size_t n = SIZE_MAX) const;
+};
+
+class BarFileReader {
+public:
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return file.isOpen() && header != nullptr; }
+
+    size_t symbolCount() const { return header ? header->symbolCount : 0; }
+    uint64_t totalBars() const { return header ? header->totalBars : 0; }
+    std::vector<std::string> symbols() const;
+
+    bool series(size_t index, BarSeriesView& out) const;
+    bool find(const std::string& code, BarSeriesView& out) const;
+
+private:
+    MappedFile file;
+    const BarFileHeader* header = nullptr;
+    const BarFileIndexEntry* index = nullptr;
+};
+
+// 종목 단위로 컬럼을 바로 기록하고 finish()에서 인덱스와 헤더를 채움
+class BarFileWriter {
+public:
+    ~BarFileWriter();
+
+    bool open(const std::string& path);
+    bool addSeries(const std::string& code, const std::vector<OHLCV>& candles);
+    bool finish();
+
+private:
+    std::ofstream out;
+    std::string outputPath;
+    std::vector<BarFileIndexEntry> entries;
+    uint64_t totalBars = 0;
+    uint64_t offset = 0;
+
+    template <typename T, typename F>
+    void writeColumn(const std::vector<OHLCV>& candles, F field);
+};
+
+} // namespace yuanta
+
+#endif // BAR_FILE_H
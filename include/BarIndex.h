@@ -0,0 +1,56 @@
+#ifndef BAR_INDEX_H
+#define BAR_INDEX_H
+
+#include "TechnicalIndicators.h"
+#include "Span.h"
+#include <vector>
+#include <cstddef>
+
+namespace yuanta {
+
+// 시간순으로 정렬된 봉 배열의 시각 범위 조회 (이진 탐색, 복사 없음)
+// 반환되는 뷰는 원본 배열이 살아 있고 변경되지 않는 동안에만 유효하다.
+size_t lowerBoundTime(Span<OHLCV> bars, long long timestamp);   // timestamp 이상인 첫 봉
+size_t upperBoundTime(Span<OHLCV> bars, long long timestamp);   // timestamp 초과인 첫 봉
+Span<OHLCV> barsBetween(Span<OHLCV> bars, long long startTime, long long endTime);  // 양끝 포함
+
+// 거래일 인덱스: 일자별 봉 구간 [begin, end)
+// 일자 경계는 한국 시간(UTC+9) 0시 기준
+class DayIndex {
+public:
+    struct Day {
+        long long date;     // 해당 일 0시 (KST)의 epoch ms
+        size_t begin;
+        size_t end;
+    };
+
+    static constexpr long long DAY_MS = 24LL * 60 * 60 * 1000;
+    static constexpr long long KST_OFFSET_MS = 9LL * 60 * 60 * 1000;
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    DayIndex() = default;
+    explicit DayIndex(Span<OHLCV> bars) { build(bars); }
+
+    // 봉 배열이 바뀌면 다시 만들어야 한다
+    void build(Span<OHLCV> bars);
+
+    size_t dayCount() const { return days.size(); }
+    const Day& day(size_t i) const { return days[i]; }
+
+    // i번째 거래일부터 count일의 봉 뷰
+    Span<OHLCV> dayBars(size_t i) const { return dayRange(i, 1); }
+    Span<OHLCV> dayRange(size_t first, size_t count) const;
+
+    // timestamp가 속한 거래일 번호 (없으면 npos)
+    size_t findDay(long long timestamp) const;
+
+    static long long dayStart(long long timestamp);
+
+private:
+    Span<OHLCV> bars;
+    std::vector<Day> days;
+};
+
+} // namespace yuanta
+
+#endif // BAR_INDEX_H
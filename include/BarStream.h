@@ -0,0 +1,64 @@
+#ifndef BAR_STREAM_H
+#define BAR_STREAM_H
+
+#include "TechnicalIndicators.h"
+#include "Span.h"
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace yuanta {
+
+// 여러 종목의 시각순 봉 시리즈를 하나의 시각순 스트림으로 병합 (k-way merge)
+// 종목마다 커서 하나를 두고 (다음 봉 시각, 시리즈 번호)를 키로 하는 이진 최소 힙에서
+// 가장 이른 봉을 꺼낸다. 같은 시각의 봉은 시리즈 추가 순서대로 나온다.
+// 힙 항목은 시각을 직접 들고 있어 비교 시 봉 배열을 따라가지 않으며,
+// 필요한 메모리는 addSeries()에서 모두 잡아 두므로 next()는 할당하지 않는다.
+class MergedBarStream {
+public:
+    struct Event {
+        size_t series;      // addSeries() 순서
+        size_t index;       // 시리즈 내 봉 위치
+        const OHLCV* bar;
+    };
+
+    MergedBarStream() = default;
+
+    // 시리즈 개수만큼 미리 공간 확보 (선택)
+    void reserve(size_t seriesCount);
+
+    // 시리즈 추가 (start번째 봉부터 내보냄). 순회를 시작한 뒤에는 추가하지 않는다.
+    // bars는 스트림보다 오래 살아 있어야 한다.
+    size_t addSeries(Span<OHLCV> bars, size_t start = 0);
+
+    // 다음 봉 (모두 소진되면 false)
+    bool next(Event& out);
+
+    // 다음 봉의 시각 (소진되었으면 false)
+    bool peekTime(long long& timestamp) const;
+
+    bool empty() const { return heap.empty(); }
+    size_t seriesCount() const { return series.size(); }
+    size_t remaining() const;
+
+private:
+    struct HeapEntry {
+        long long time;
+        uint32_t series;
+
+        bool before(const HeapEntry& other) const {
+            return time < other.time || (time == other.time && series < other.series);
+        }
+    };
+
+    std::vector<Span<OHLCV>> series;
+    std::vector<size_t> cursors;        // 시리즈별 다음 봉 위치
+    std::vector<HeapEntry> heap;
+
+    void siftUp(size_t pos);
+    void siftDown(size_t pos);
+};
+
+} // namespace yuanta
+
+#endif // BAR_STREAM_H
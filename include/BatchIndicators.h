@@ -0,0 +1,67 @@
+#ifndef BATCH_INDICATORS_H
+#define BATCH_INDICATORS_H
+
+#include "TechnicalIndicators.h"
+#include <vector>
+#include <cstddef>
+
+namespace yuanta {
+
+// 여러 종목의 봉 데이터를 필드별 배열로 보관하는 SoA 블록
+// 배열은 봉 우선(bar-major) 배치: field[bar * numSymbols + symbol]
+// 같은 시점의 종목들이 메모리상 연속이므로 종목 방향으로 SIMD 레인을 채운다.
+struct CandleBlock {
+    size_t numSymbols = 0;
+    size_t numBars = 0;
+    std::vector<double> open;
+    std::vector<double> high;
+    std::vector<double> low;
+    std::vector<double> close;
+    std::vector<double> volume;
+
+    // 종목별 첫 유효 봉 위치 (그 앞은 NaN 패딩, 채우지 않은 종목은 numBars)
+    std::vector<size_t> firstValid;
+
+    // 크기 설정 (모든 값은 NaN으로 초기화)
+    void resize(size_t symbols, size_t bars);
+
+    // 종목 데이터 채우기 (최근 numBars개를 오른쪽 정렬, 부족한 앞부분은 NaN)
+    void setSeries(size_t symbol, const std::vector<OHLCV>& candles);
+
+    size_t index(size_t bar, size_t symbol) const { return bar * numSymbols + symbol; }
+    size_t firstValidBar(size_t symbol) const {
+        return symbol < firstValid.size() ? firstValid[symbol] : numBars;
+    }
+};
+
+// 볼린저 밴드 일괄 계산 결과 (CandleBlock과 같은 배치)
+struct BatchBands {
+    std::vector<double> upper;
+    std::vector<double> middle;
+    std::vector<double> lower;
+    std::vector<double> bandwidth;
+};
+
+// 종목 일괄 지표 계산
+// 출력은 입력과 같은 numBars × numSymbols 배치이며, 종목마다 첫 유효 봉부터 계산해
+// 그 앞의 패딩과 지표가 아직 계산되지 않는 초기 구간은 NaN으로 채워진다.
+// (봉 수가 짧은 종목도 자기 시리즈로 xxxVector를 계산한 것과 같은 값)
+// AVX2(4레인) / NEON(2레인) 빌드에서는 종목 방향 벡터 연산, 그 외에는 스칼라로 계산한다.
+// 한 레인 묶음 안에서 첫 유효 봉이 다르면 그 묶음은 종목별 스칼라로 계산한다.
+class BatchIndicators {
+public:
+    static void SMA(const CandleBlock& block, int period, std::vector<double>& out);
+    static void EMA(const CandleBlock& block, int period, std::vector<double>& out);
+    static void RSI(const CandleBlock& block, int period, std::vector<double>& out);
+    static void BollingerBand(const CandleBlock& block, int period, double stdDev,
+                              BatchBands& out);
+    static void ATR(const CandleBlock& block, int period, std::vector<double>& out);
+
+    // 빌드에 사용된 SIMD 백엔드 ("AVX2", "NEON", "Scalar")
+    static const char* backendName();
+    static size_t laneWidth();
+};
+
+} // namespace yuanta
+
+#endif // BATCH_INDICATORS_H
@@ -0,0 +1,40 @@
+#ifndef CSV_BAR_PARSER_H
+#define CSV_BAR_PARSER_H
+
+#include "TechnicalIndicators.h"
+#include <string>
+#include <vector>
+#include <cstddef>
+
+namespace yuanta {
+
+// CSV 파싱 결과
+struct CSVParseResult {
+    size_t rows = 0;                        // 정상 파싱된 행
+    size_t malformed = 0;                   // 형식 오류 행
+    std::vector<size_t> malformedLines;     // 오류 행 번호 (1부터, 최대 MAX_REPORTED_LINES개)
+    size_t bytes = 0;
+
+    static const size_t MAX_REPORTED_LINES = 20;
+};
+
+// 고속 봉 CSV 파서
+// 형식: timestamp,open,high,low,close,volume (첫 줄이 숫자로 시작하지 않으면 헤더로 간주)
+// 파일을 메모리 맵한 뒤 memchr로 줄/필드를 나누고 std::from_chars로 변환한다.
+// 줄 단위 문자열/스트림 할당과 예외가 없으며, 형식 오류 행은 건너뛰되 결과에 보고한다.
+class CSVBarParser {
+public:
+    // 파일 파싱 (candles 뒤에 추가)
+    static bool parseFile(const std::string& filepath,
+                          std::vector<OHLCV>& candles,
+                          CSVParseResult* result = nullptr);
+
+    // 메모리 버퍼 파싱 (candles 뒤에 추가)
+    static void parseBuffer(const char* begin, const char* end,
+                            std::vector<OHLCV>& candles,
+                            CSVParseResult& result);
+};
+
+} // namespace yuanta
+
+#endif // CSV_BAR_PARSER_H
@@ -0,0 +1,107 @@
+#ifndef CLOCK_H
+#define CLOCK_H
+
+#include <atomic>
+#include <chrono>
+
+namespace yuanta {
+
+// 장중 시각 (한국 시간 기준, 분 단위)
+// KST는 서머타임이 없으므로 UTC+9 고정 산술로 계산한다 (libc 시간대 조회 없음).
+struct SessionTime {
+    int minuteOfDay = 0;    // 0 ~ 1439
+    int weekday = 0;        // 0 = 일요일 ~ 6 = 토요일
+
+    static constexpr int MARKET_OPEN = 540;     // 09:00
+    static constexpr int MARKET_CLOSE = 930;    // 15:30
+    static constexpr int TIME_STOP = 870;       // 14:30 (데이트레이딩 강제 청산)
+    static constexpr long long KST_OFFSET_MS = 9LL * 60 * 60 * 1000;
+
+    bool isWeekend() const { return weekday == 0 || weekday == 6; }
+    bool isMarketHours() const {
+        return !isWeekend() && minuteOfDay >= MARKET_OPEN && minuteOfDay <= MARKET_CLOSE;
+    }
+    int minutesSinceOpen() const {
+        return minuteOfDay < MARKET_OPEN ? 0 : minuteOfDay - MARKET_OPEN;
+    }
+
+    static SessionTime fromEpochMs(long long epochMs);
+
+    // 원자 변수 하나에 담기 위한 압축 (분 11비트 + 요일 3비트)
+    int pack() const { return minuteOfDay | (weekday << 11); }
+    static SessionTime unpack(int packed) {
+        SessionTime t;
+        t.minuteOfDay = packed & 0x7FF;
+        t.weekday = packed >> 11;
+        return t;
+    }
+};
+
+// 현재 시각 공급자 (epoch 밀리초)
+// 실거래는 시스템 시계, 백테스트/리플레이는 데이터 시각을 따라가는 모의 시계를 쓴다.
+class Clock {
+public:
+    virtual ~Clock() = default;
+    virtual long long nowMs() const = 0;
+
+    // 현재 장중 시각 (구현별로 캐시됨)
+    virtual SessionTime session() const { return SessionTime::fromEpochMs(nowMs()); }
+};
+
+// 시스템 시계: 장중 시각은 초가 바뀔 때만 다시 계산
+class SystemClock : public Clock {
+public:
+    long long nowMs() const override {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+    SessionTime session() const override;
+
+private:
+    // (epoch 초 << 16) | SessionTime::pack(), -1 = 없음
+    mutable std::atomic<long long> cached{-1};
+};
+
+// 모의 시계: 리플레이/백테스트가 틱·봉마다 시각을 설정하고, 장중 시각도 그때 한 번 계산
+// (읽기는 다른 스레드에서도 안전)
+class SimulatedClock : public Clock {
+public:
+    explicit SimulatedClock(long long startMs = 0) { set(startMs); }
+
+    long long nowMs() const override { return current.load(std::memory_order_acquire); }
+    SessionTime session() const override {
+        return SessionTime::unpack(packedSession.load(std::memory_order_acquire));
+    }
+
+    void set(long long timestampMs) {
+        packedSession.store(SessionTime::fromEpochMs(timestampMs).pack(), std::memory_order_release);
+        current.store(timestampMs, std::memory_order_release);
+    }
+    void advance(long long deltaMs) { set(nowMs() + deltaMs); }
+
+private:
+    std::atomic<long long> current{0};
+    std::atomic<int> packedSession{0};
+};
+
+// 현재 스레드가 쓰는 시계 (기본: 프로세스 공용 SystemClock)
+// 장 시간 판단(전략 진입 구간, 시간 청산, 장 운영 여부)은 모두 이 시계를 거친다.
+const Clock& currentClock();
+
+// 범위 안에서 현재 스레드의 시계를 교체 (백테스트 작업마다 독립된 모의 시계 사용)
+class ScopedClock {
+public:
+    explicit ScopedClock(const Clock& clock);
+    ~ScopedClock();
+
+    ScopedClock(const ScopedClock&) = delete;
+    ScopedClock& operator=(const ScopedClock&) = delete;
+
+private:
+    const Clock* previous;
+};
+
+} // namespace yuanta
+
+#endif // CLOCK_H
@@ -0,0 +1,91 @@
+#ifndef FILL_MODEL_H
+#define FILL_MODEL_H
+
+#include "TechnicalIndicators.h"
+
+namespace yuanta {
+
+// 손절/익절 체결 결과
+struct ExitFill {
+    enum class Kind { NONE, STOP_LOSS, TAKE_PROFIT };
+
+    Kind kind = Kind::NONE;
+    double price = 0.0;                 // 슬리피지/호가 단위 반영 후 체결가
+
+    bool triggered() const { return kind != Kind::NONE; }
+};
+
+// 한 봉에서 손절가와 익절가가 모두 닿았을 때 어느 쪽이 먼저인지에 대한 가정
+enum class IntrabarPath {
+    PESSIMISTIC,        // 항상 손절 먼저
+    OPTIMISTIC,         // 항상 익절 먼저
+    BAR_DIRECTION       // 양봉은 시가→저가→고가→종가, 음봉은 시가→고가→저가→종가
+};
+
+struct FillModelConfig {
+    IntrabarPath path = IntrabarPath::PESSIMISTIC;
+    double baseSlippage = 0.0005;       // 시장가 체결마다 (호가 스프레드 절반)
+    double impactCoefficient = 0.01;    // 시장 충격: 계수 × sqrt(주문 수량 / 봉 거래량)
+    double maxSlippage = 0.02;
+    bool roundToTick = true;            // 체결가를 KRX 호가 단위로 (매수는 올림, 매도는 내림)
+};
+
+// 백테스트 체결 모델
+// 시뮬레이터는 봉(또는 틱을 가격 하나짜리 봉으로 본 것)마다 보유 포지션의 손절/익절을
+// checkExit로 확인하고, 진입과 그 밖의 청산(시간 청산 등)은 buyPrice/sellPrice로 체결한다.
+// 상태가 없으므로 병렬 백테스트 작업들이 한 인스턴스를 공유해도 된다.
+class FillModel {
+public:
+    virtual ~FillModel() = default;
+
+    virtual ExitFill checkExit(const OHLCV& bar, double stopLoss, double takeProfit,
+                               int quantity) const = 0;
+
+    // 시장가 체결가 (price 기준, barVolume 거래량 봉에서 quantity주)
+    virtual double buyPrice(double price, int quantity, long long barVolume) const = 0;
+    virtual double sellPrice(double price, int quantity, long long barVolume) const = 0;
+
+    // KRX 호가 가격 단위 (2023년 유가증권/코스닥 통합 기준)
+    static double tickSize(double price);
+    static double roundUpToTick(double price);
+    static double roundDownToTick(double price);
+};
+
+// 이전 방식: 종가로만 손절/익절 판단, 모든 체결에 고정 슬리피지 (결과 비교용)
+class CloseFillModel : public FillModel {
+public:
+    explicit CloseFillModel(double slippage = 0.001) : slippage(slippage) {}
+
+    ExitFill checkExit(const OHLCV& bar, double stopLoss, double takeProfit,
+                       int quantity) const override;
+    double buyPrice(double price, int quantity, long long barVolume) const override;
+    double sellPrice(double price, int quantity, long long barVolume) const override;
+
+private:
+    double slippage;
+};
+
+// 봉 내 체결: 고가/저가로 손절(역지정 시장가)과 익절(지정가)을 판단
+// - 시가가 이미 손절가 아래/익절가 위면 시가에 체결 (갭)
+// - 손절은 트리거 후 시장가 매도라서 슬리피지 적용, 익절은 호가 단위로 올린 지정가에 체결
+// - 슬리피지 = 기본 + 충격 계수 × sqrt(거래량 참여율), 상한 maxSlippage
+class IntrabarFillModel : public FillModel {
+public:
+    explicit IntrabarFillModel(const FillModelConfig& config = FillModelConfig())
+        : config(config) {}
+
+    ExitFill checkExit(const OHLCV& bar, double stopLoss, double takeProfit,
+                       int quantity) const override;
+    double buyPrice(double price, int quantity, long long barVolume) const override;
+    double sellPrice(double price, int quantity, long long barVolume) const override;
+
+    double slippage(int quantity, long long barVolume) const;
+    const FillModelConfig& getConfig() const { return config; }
+
+private:
+    FillModelConfig config;
+};
+
+} // namespace yuanta
+
+#endif // FILL_MODEL_H
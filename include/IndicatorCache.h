@@ -0,0 +1,180 @@
+#ifndef INDICATOR_CACHE_H
+#define INDICATOR_CACHE_H
+
+#include "TechnicalIndicators.h"
+#include "SymbolRegistry.h"
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace yuanta {
+
+// 지표 종류
+enum class IndicatorType {
+    SMA,
+    EMA,
+    RSI,
+    MACD,
+    BOLLINGER,
+    ATR,
+    VWAP
+};
+
+// 지표 캐시 키 (지표 종류 + 파라미터)
+struct IndicatorKey {
+    IndicatorType type;
+    int param1 = 0;
+    int param2 = 0;
+    int param3 = 0;
+    double param4 = 0.0;
+
+    bool operator<(const IndicatorKey& other) const;
+};
+
+// 전 구간 지표 컬럼 (백테스트용)
+// 한 종목의 전체 봉 시리즈에 대해 요청된 지표를 한 번씩만 계산해 두고,
+// 봉 i 시점의 컨텍스트는 컬럼에서 구간 뷰만 잘라 읽는다 (봉마다 재계산 없음).
+// 값은 시리즈 처음부터 이어서 계산되므로 EMA/RSI/ATR/MACD처럼 이전 값에 의존하는
+// 지표는 lookback 구간만으로 계산한 값과 초기값(시드) 차이만큼 다를 수 있다.
+// VWAP처럼 구간 시작점에서 누적을 새로 시작하는 지표는 컬럼으로 만들지 않는다.
+class IndicatorColumns {
+public:
+    IndicatorColumns() = default;
+
+    // candles/closes는 컬럼보다 오래 살아 있어야 한다 (같은 길이의 같은 구간)
+    IndicatorColumns(Span<OHLCV> candles, Span<double> closes,
+                     const std::vector<IndicatorKey>& keys);
+
+    // 지표 컬럼 추가 (이미 있으면 무시, 지원하지 않는 지표면 false)
+    bool add(const IndicatorKey& key);
+
+    size_t size() const;
+    size_t barCount() const { return candles.size(); }
+
+    // 봉 [begin, begin + length) 구간으로 TechnicalIndicators::xxxVector를 계산한 것과
+    // 같은 정렬의 뷰 (컬럼이 없으면 false)
+    bool series(const IndicatorKey& key, size_t begin, size_t length, Span<double>& out) const;
+    bool bands(const IndicatorKey& key, size_t begin, size_t length,
+               Span<BollingerBands>& out) const;
+
+    // 같은 구간의 마지막 봉 기준 MACD (컬럼이 없으면 nullptr)
+    const MACDResult* macd(const IndicatorKey& key, size_t begin, size_t length) const;
+
+    // 지표 첫 값이 나오는 봉 위치 (SMA/EMA/볼린저: period-1, RSI/ATR: period)
+    static size_t warmup(const IndicatorKey& key);
+
+private:
+    Span<OHLCV> candles;
+    Span<double> closes;
+
+    // xxxVector 결과 그대로 보관 (첫 값이 warmup(key)번째 봉에 해당)
+    std::map<IndicatorKey, std::vector<double>> seriesColumns;
+    std::map<IndicatorKey, std::vector<BollingerBands>> bandColumns;
+    // MACD는 봉 위치 그대로 보관 (계산 전 구간은 0)
+    std::map<IndicatorKey, std::vector<MACDResult>> macdColumns;
+};
+
+// 한 종목·한 주기의 완성 봉 묶음과 그에 대한 지표 계산 결과
+// 봉이 완성될 때마다 새로 만들어지며, 지표는 처음 요청될 때 한 번만 계산되어
+// 같은 봉에 대해 여러 전략이 읽기 전용으로 공유한다.
+class IndicatorContext {
+public:
+    // 봉을 복사해 보관 (캐시에 두고 공유하는 컨텍스트용)
+    IndicatorContext(const std::string& code, int timeframe,
+                     const std::vector<OHLCV>& candles);
+
+    // 복사 없는 뷰 (백테스트처럼 긴 시리즈의 구간을 매 봉 넘기는 경우)
+    // candles/closes는 컨텍스트보다 오래 살아 있어야 하며, closes가 비어 있으면
+    // candles에서 종가를 추출해 보관한다.
+    IndicatorContext(const std::string& code, int timeframe,
+                     Span<OHLCV> candles, Span<double> closes = Span<double>());
+
+    // 미리 계산된 컬럼을 읽는 뷰 (candles는 컬럼 시리즈의 columnOffset부터 시작하는 구간)
+    // 컬럼에 없는 지표는 구간으로 직접 계산한다.
+    IndicatorContext(const std::string& code, int timeframe,
+                     Span<OHLCV> candles, Span<double> closes,
+                     const IndicatorColumns* columns, size_t columnOffset);
+
+    // 종목 ID를 이미 아는 경우의 뷰 (레지스트리 조회 없음, 백테스트처럼 매 봉 만드는 경로용)
+    IndicatorContext(const std::string& code, SymbolId symbolId, int timeframe,
+                     Span<OHLCV> candles, Span<double> closes,
+                     const IndicatorColumns* columns = nullptr, size_t columnOffset = 0);
+
+    const std::string& getCode() const { return code; }
+    SymbolId getSymbolId() const { return symbolId; }
+    int getTimeframe() const { return timeframe; }
+    Span<OHLCV> getCandles() const { return candles; }
+    Span<double> getCloses() const { return closes; }
+    long long getLastBarTime() const;
+
+    // 지표 시계열 (TechnicalIndicators::xxxVector와 동일한 정렬, 컨텍스트가 살아 있는 동안 유효)
+    Span<double> sma(int period) const;
+    Span<double> ema(int period) const;
+    Span<double> rsi(int period = 14) const;
+    Span<double> atr(int period = 14) const;
+    Span<double> vwap() const;
+    Span<BollingerBands> bollinger(int period = 20, double stdDev = 2.0) const;
+
+    // 최신 MACD
+    const MACDResult& macd(int fastPeriod = 12, int slowPeriod = 26,
+                           int signalPeriod = 9) const;
+
+    // 다른 곳(종목 일괄 계산)에서 구한 지표를 미리 채움 (xxxVector와 같은 정렬)
+    // 캐시에 게시해 공유하기 전에만 호출한다.
+    void preload(const IndicatorKey& key, std::vector<double> values);
+    void preloadBands(const IndicatorKey& key, std::vector<BollingerBands> bands);
+
+private:
+    std::string code;
+    SymbolId symbolId;
+    int timeframe;
+
+    // 보관 중인 데이터 (뷰 생성자에서는 비어 있을 수 있음)
+    std::vector<OHLCV> ownedCandles;
+    std::vector<double> ownedCloses;
+
+    Span<OHLCV> candles;
+    Span<double> closes;
+
+    // 미리 계산된 컬럼 (없으면 nullptr)
+    const IndicatorColumns* columns = nullptr;
+    size_t columnOffset = 0;
+
+    // 컬럼에 없는 시계열 지표 지연 계산
+    Span<double> cachedSeries(const IndicatorKey& key) const;
+
+    // 지연 계산 결과 (std::map 노드는 삽입 후에도 주소가 유지됨)
+    mutable std::mutex cacheMutex;
+    mutable std::map<IndicatorKey, std::vector<double>> seriesCache;
+    mutable std::map<IndicatorKey, std::vector<BollingerBands>> bandCache;
+    mutable std::map<IndicatorKey, MACDResult> macdCache;
+};
+
+// 종목·주기별 지표 컨텍스트 저장소
+// MarketDataManager의 분봉 완성 콜백에서 invalidate()를 호출하면
+// 다음 조회 시 새 봉 기준으로 컨텍스트가 다시 만들어진다.
+class IndicatorCache {
+public:
+    // 캐시된 컨텍스트 조회 (무효화되었거나 봉 구성이 바뀌었으면 새로 생성)
+    std::shared_ptr<const IndicatorContext> getContext(const std::string& code,
+                                                       int timeframe,
+                                                       const std::vector<OHLCV>& candles);
+
+    // 미리 계산해 둔 컨텍스트 게시 (같은 종목·주기의 기존 컨텍스트를 교체)
+    void publish(std::shared_ptr<const IndicatorContext> ctx);
+
+    // 분봉 완성 시 호출
+    void invalidate(const std::string& code, int timeframe);
+    void clear();
+    size_t size() const;
+
+private:
+    std::map<std::pair<std::string, int>, std::shared_ptr<const IndicatorContext>> contexts;
+    mutable std::mutex cacheMutex;
+};
+
+} // namespace yuanta
+
+#endif // INDICATOR_CACHE_H
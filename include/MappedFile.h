@@ -0,0 +1,45 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <string>
+#include <cstddef>
+
+namespace yuanta {
+
+// 읽기 전용 메모리 맵 파일 (Windows: CreateFileMapping, 그 외: mmap)
+// 파일 내용을 복사하지 않고 페이지 캐시를 그대로 참조한다.
+class MappedFile {
+public:
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    bool open(const std::string& path);
+    void close();
+
+    bool isOpen() const { return mapped != nullptr || (opened && fileSize == 0); }
+    const char* data() const { return static_cast<const char*>(mapped); }
+    size_t size() const { return fileSize; }
+    const std::string& path() const { return filePath; }
+
+private:
+    void* mapped = nullptr;
+    size_t fileSize = 0;
+    bool opened = false;
+    std::string filePath;
+
+#ifdef _WIN32
+    void* fileHandle = nullptr;
+    void* mappingHandle = nullptr;
+#endif
+
+    void moveFrom(MappedFile& other);
+};
+
+} // namespace yuanta
+
+#endif // MAPPED_FILE_H
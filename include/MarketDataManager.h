@@ -3,19 +3,28 @@
 
 #include "YuantaAPI.h"
 #include "TechnicalIndicators.h"
+#include "RingBuffer.h"
+#include "SymbolRegistry.h"
+#include "SPSCQueue.h"
+#include "SeqLock.h"
+#include "BarFile.h"
 #include <string>
 #include <vector>
 #include <map>
-#include <deque>
 #include <mutex>
 #include <memory>
 #include <functional>
 #include <thread>
 #include <atomic>
+#include <array>
+#include <chrono>
 
 namespace yuanta {
 
 // 시장 데이터 관리자
+// 종목 데이터는 SymbolId로 인덱싱하는 평탄 배열에 저장되며, 락은 ID를 샤드 수로
+// 나눈 나머지로 분산된다. 한 종목의 시세 수신이 다른 샤드 종목의 조회를 막지 않는다.
+// 문자열 인자 함수는 레지스트리에서 ID를 찾아 ID 버전으로 위임한다.
 class MarketDataManager {
 public:
     MarketDataManager();
@@ -30,22 +39,100 @@ public:
     std::vector<std::string> getWatchlist() const;
 
     // 실시간 시세 구독 시작/중지
+    // 시세/호가 콜백은 수신 큐에 넣기만 하고, 전용 수신 스레드가 processQuote와
+    // 호가 스냅샷 갱신을 수행한다 (콜백 스레드는 샤드 락을 잡지 않음).
+    // 시뮬레이션 모드에서는 API의 모의 시세 피드도 함께 시작/중지한다.
     bool startRealtime();
     void stopRealtime();
     bool isRealtimeRunning() const;
 
-    // 데이터 조회
+    // 수신 큐에 시세 추가 (생산자 스레드 하나에서만 호출, 가득 차면 버리고 false)
+    bool enqueueQuote(const QuoteData& quote);
+
+    // 호가 큐에 추가 (호가 콜백 스레드 하나에서만 호출, 가득 차면 버리고 false)
+    bool enqueueOrderbook(const OrderbookData& orderbook);
+
+    // 수신 큐 통계
+    struct IngestStats {
+        size_t depth = 0;              // 현재 대기 수
+        size_t maxDepth = 0;           // 최대 대기 수
+        size_t capacity = 0;
+        long long enqueued = 0;
+        long long processed = 0;
+        long long dropped = 0;         // 큐가 가득 차 버린 시세
+        long long orderbookDropped = 0;  // 호가 큐가 가득 차 버린 호가
+        long long maxLatencyUs = 0;    // 큐 대기 시간 최대 (마이크로초)
+        double avgLatencyUs = 0.0;
+    };
+    IngestStats getIngestStats() const;
+
+    // 봉 주기 (분 단위, 일봉은 TIMEFRAME_DAILY)
+    // 1분봉과 일봉은 항상 유지되며, 상위 분봉은 완성된 1분봉을 누적해 만든다.
+    // 1440의 약수만 허용 (1, 3, 5, 10, 15, 30, 60 ...)
+    static constexpr int TIMEFRAME_DAILY = 1440;
+    static constexpr size_t MAX_TIMEFRAMES = 10;
+
+    // 주기 등록: 이후 추가되는 종목의 기본 주기 / 특정 종목
+    bool setDefaultTimeframes(const std::vector<int>& minutesList);
+    bool registerTimeframe(const std::string& code, int minutes);
+    std::vector<int> getTimeframes(const std::string& code) const;
+
+    // 시세/호가 스냅샷 (문자열 없는 고정 크기 값, 시퀀스 락으로 보관)
+    struct QuoteSnapshot {
+        double currentPrice = 0;
+        double openPrice = 0;
+        double highPrice = 0;
+        double lowPrice = 0;
+        double prevClose = 0;
+        long long volume = 0;
+        long long prevVolume = 0;
+        double changeRate = 0;
+        long long timestamp = 0;
+    };
+    struct OrderbookSnapshot {
+        double bidPrices[10] = {0};
+        double askPrices[10] = {0};
+        long long bidVolumes[10] = {0};
+        long long askVolumes[10] = {0};
+    };
+
+    // 대기 없는 읽기: 락을 잡지 않고 최신 스냅샷을 복사 (기록 중이면 재시도)
+    bool getQuoteSnapshot(SymbolId id, QuoteSnapshot& out) const;
+    bool getOrderbookSnapshot(SymbolId id, OrderbookSnapshot& out) const;
+
+    // 데이터 조회 (시세/호가는 스냅샷 기반, 락 없음)
     QuoteData getQuote(const std::string& code) const;
+    QuoteData getQuote(SymbolId id) const;
     std::vector<OHLCV> getMinuteCandles(const std::string& code,
                                          int minutes = 1,
                                          int count = 100) const;
     std::vector<OHLCV> getDailyCandles(const std::string& code,
                                         int count = 60) const;
+
+    // 호출자 버퍼 재사용 버전 (out의 용량이 충분하면 할당 없음)
+    // 반환값: 복사된 봉 개수
+    size_t getMinuteCandles(const std::string& code, int minutes, int count,
+                            std::vector<OHLCV>& out) const;
+    size_t getMinuteCandles(SymbolId id, int minutes, int count,
+                            std::vector<OHLCV>& out) const;
+
+    // 복사 없는 조회: 샤드 락을 잡은 채로 최근 count개 봉 뷰를 visitor에 전달
+    // 뷰는 visitor 안에서만 유효하며, visitor에서 이 객체를 다시 호출하면 안 된다.
+    using CandleView = RingBuffer<OHLCV>::RingView;
+    using CandleVisitor = std::function<void(const CandleView& candles)>;
+    bool visitMinuteCandles(const std::string& code, int minutes, int count,
+                            const CandleVisitor& visitor) const;
+    bool visitMinuteCandles(SymbolId id, int minutes, int count,
+                            const CandleVisitor& visitor) const;
     OrderbookData getOrderbook(const std::string& code) const;
+    OrderbookData getOrderbook(SymbolId id) const;
 
     // 실시간 분봉 생성
     void processQuote(const QuoteData& quote);
 
+    // 실시간 호가 갱신 (호출 스레드에서 샤드 락을 잡고 바로 반영)
+    void processOrderbook(const OrderbookData& orderbook);
+
     // 일중 분봉 데이터 (장 중 누적)
     std::vector<OHLCV> getIntradayCandles(const std::string& code,
                                            int minutes = 1) const;
@@ -64,6 +151,17 @@ public:
     // 과거 데이터 로드
     bool loadHistoricalData(const std::string& code, int days = 20);
 
+    // 바이너리 봉 파일에서 분봉 워밍업 (API 조회 없음, 최근 보관 용량만큼만 적재)
+    bool loadHistoricalData(const std::string& code, const BarFileReader& minuteFile);
+
+    // 여러 종목 과거 데이터 병렬 워밍업
+    // 최대 maxConcurrency개 스레드가 종목을 나눠 조회/디코딩하고, 종목별 시리즈를
+    // 락 밖에서 만든 뒤 샤드 락 안에서 포인터 교체로 한 번에 게시한다.
+    // minuteFile에 있는 종목은 API 대신 파일에서 분봉을 읽는다. 반환값: 로드된 종목 수
+    size_t warmUpHistory(const std::vector<std::string>& codes, int days,
+                         const BarFileReader* minuteFile = nullptr,
+                         size_t maxConcurrency = 4);
+
     // 데이터 캐시 관리
     void clearCache(const std::string& code = "");
     size_t getCacheSize() const;
@@ -75,22 +173,48 @@ public:
 private:
     YuantaAPI* api = nullptr;
 
+    // 봉 보관 개수 (종목 추가 시 한 번에 할당)
+    static constexpr size_t MINUTE_CANDLE_CAPACITY = 500;
+    static constexpr size_t DAILY_CANDLE_CAPACITY = 500;
+
+    // 한 주기의 봉 시리즈
+    struct CandleSeries {
+        int minutes;
+        RingBuffer<OHLCV> candles;
+        OHLCV current{};            // 현재 형성 중인 봉
+        long long slot = 0;         // 현재 봉 시작 시각 (0 = 형성 중인 봉 없음)
+
+        CandleSeries(int minutes, size_t capacity) : minutes(minutes), candles(capacity) {}
+    };
+
     // 종목별 데이터 저장소
     struct StockData {
-        QuoteData quote;
-        OrderbookData orderbook;
-        std::deque<OHLCV> minute1Candles;
-        std::deque<OHLCV> minute5Candles;
-        std::deque<OHLCV> dailyCandles;
-        OHLCV currentCandle1;   // 현재 형성 중인 1분봉
-        OHLCV currentCandle5;   // 현재 형성 중인 5분봉
-        long long lastCandleTime1 = 0;
-        long long lastCandleTime5 = 0;
+        std::vector<CandleSeries> series;   // [0] = 1분봉, 이후 주기 오름차순
+        long long lastCumVolume = -1;       // 직전 시세의 누적 거래량 (-1 = 없음)
     };
 
-    std::map<std::string, StockData> stockData;
+    // 종목 추가 시 적용할 주기 목록
+    std::vector<int> defaultTimeframes{1, 5, TIMEFRAME_DAILY};
+    mutable std::mutex timeframeMutex;
+
+    // 종목 데이터 (SymbolId 인덱스, 크기 고정)
+    // stocks[id]는 shards[id % SHARD_COUNT]의 락으로 보호된다.
+    std::vector<std::unique_ptr<StockData>> stocks;
+
+    // 최신 시세/호가 스냅샷 (SymbolId 인덱스, 크기 고정)
+    // 쓰기는 샤드 락 안에서만 수행하고, 읽기는 락 없이 수행한다.
+    std::unique_ptr<SeqLock<QuoteSnapshot>[]> quoteSnapshots;
+    std::unique_ptr<SeqLock<OrderbookSnapshot>[]> orderbookSnapshots;
+
+    // 락 샤드
+    static constexpr size_t SHARD_COUNT = 16;
+    struct Shard {
+        mutable std::mutex mtx;
+    };
+    std::array<Shard, SHARD_COUNT> shards;
+
     std::vector<std::string> watchlist;
-    mutable std::mutex dataMutex;
+    mutable std::mutex watchlistMutex;
 
     // 콜백
     QuoteUpdateCallback quoteCallback;
@@ -100,12 +224,67 @@ private:
     std::atomic<bool> realtimeRunning{false};
     std::thread realtimeThread;
 
+    // 수신 큐 (API 콜백 스레드 → 수신 스레드)
+    static constexpr size_t INGEST_QUEUE_CAPACITY = 8192;
+    struct IngestItem {
+        QuoteData quote;
+        std::chrono::steady_clock::time_point enqueuedAt;
+    };
+    SPSCQueue<IngestItem> ingestQueue{INGEST_QUEUE_CAPACITY};
+
+    // 호가 큐 (호가 콜백 스레드 → 수신 스레드, 문자열 없는 스냅샷만 전달)
+    static constexpr size_t ORDERBOOK_QUEUE_CAPACITY = 4096;
+    struct OrderbookItem {
+        SymbolId id = INVALID_SYMBOL_ID;
+        OrderbookSnapshot snapshot;
+    };
+    SPSCQueue<OrderbookItem> orderbookQueue{ORDERBOOK_QUEUE_CAPACITY};
+    std::atomic<long long> orderbookDropped{0};
+
+    std::atomic<long long> ingestEnqueued{0};
+    std::atomic<long long> ingestProcessed{0};
+    std::atomic<long long> ingestDropped{0};
+    std::atomic<size_t> ingestMaxDepth{0};
+    std::atomic<long long> ingestMaxLatencyUs{0};
+    std::atomic<long long> ingestTotalLatencyUs{0};
+
+    void ingestLoop();
+
     // 헬퍼 함수
-    void updateCurrentCandle(StockData& data, const QuoteData& quote,
-                             int minutes, OHLCV& currentCandle,
-                             long long& lastTime);
-    void completeCandle(const std::string& code, int minutes,
-                        const OHLCV& candle, std::deque<OHLCV>& candles);
+    std::mutex& shardMutex(SymbolId id) const;
+    StockData* stockFor(SymbolId id) const;   // 해당 샤드 락을 잡은 상태에서 호출
+    void resetSnapshots(SymbolId id);          // 해당 샤드 락을 잡은 상태에서 호출
+    void storeOrderbook(SymbolId id, const OrderbookSnapshot& snapshot);  // 샤드 락을 잡고 기록
+    static OrderbookSnapshot toSnapshot(const OrderbookData& orderbook);
+
+    // 봉 집계: 완성된 봉은 completed/completedMinutes에 기록 (최대 MAX_TIMEFRAMES개)
+    struct CompletedCandles {
+        OHLCV candles[MAX_TIMEFRAMES];
+        int minutes[MAX_TIMEFRAMES];
+        size_t count = 0;
+    };
+    void aggregateQuote(StockData& data, const QuoteData& quote, CompletedCandles& completed);
+    void closeCandle(CandleSeries& series, CompletedCandles& completed);
+    void rollUp(CandleSeries& series, const OHLCV& bar, CompletedCandles& completed);
+
+    std::unique_ptr<StockData> createStockData(const std::vector<int>& minutesList) const;
+
+    // 과거 데이터 적재: 락 없이 새 StockData를 만든 뒤 publishStockData로 교체
+    struct HistoryLoadStats {
+        size_t dailyCandles = 0;
+        size_t minuteCandles = 0;
+    };
+    std::vector<int> historyTimeframes(SymbolId id) const;  // 기본 주기 + 종목에 등록된 주기
+    std::unique_ptr<StockData> buildHistoryFromAPI(const std::string& code, int days,
+                                                   const std::vector<int>& timeframes,
+                                                   HistoryLoadStats& stats);
+    std::unique_ptr<StockData> buildHistoryFromBarFile(const BarSeriesView& view,
+                                                       const std::vector<int>& timeframes,
+                                                       HistoryLoadStats& stats);
+    void publishStockData(SymbolId id, std::unique_ptr<StockData> data);
+    static bool isValidTimeframe(int minutes);
+    static void addSeries(StockData& data, int minutes);
+    const RingBuffer<OHLCV>* minuteSeries(const StockData& data, int minutes) const;
     long long getMinuteSlot(long long timestamp, int minutes) const;
 };
 
@@ -118,17 +297,32 @@ public:
     bool loadFromCSV(const std::string& filepath,
                      std::vector<OHLCV>& candles);
 
-    // API에서 다운로드 및 저장
+    // 바이너리 봉 파일(.ybar)에서 한 종목 로드
+    bool loadFromBinary(const std::string& filepath,
+                        const std::string& code,
+                        std::vector<OHLCV>& candles);
+
+    // CSV 파일들을 하나의 바이너리 봉 파일로 변환 (종목코드, CSV 경로)
+    bool convertCSVToBinary(const std::vector<std::pair<std::string, std::string>>& sources,
+                            const std::string& outputPath);
+
+    // API에서 다운로드 및 저장 (확장자가 .ybar면 바이너리, 아니면 CSV)
     bool downloadAndSave(YuantaAPI* api,
                          const std::string& code,
                          const std::string& outputPath,
                          int days = 180);
 
-    // 날짜 범위로 필터
+    // 날짜 범위로 필터 (양끝 포함, 결과를 복사)
     std::vector<OHLCV> filterByDate(const std::vector<OHLCV>& candles,
                                      long long startTime,
                                      long long endTime);
 
+    // 날짜 범위 뷰 (양끝 포함, 이진 탐색, 복사 없음)
+    // candles는 시각순 정렬이어야 하며, 뷰는 candles가 변경되기 전까지만 유효하다.
+    Span<OHLCV> sliceByDate(const std::vector<OHLCV>& candles,
+                            long long startTime,
+                            long long endTime) const;
+
 private:
     std::string dataDirectory;
 };
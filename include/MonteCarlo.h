@@ -0,0 +1,86 @@
+#ifndef MONTE_CARLO_H
+#define MONTE_CARLO_H
+
+#include "Backtester.h"
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace yuanta {
+
+class ThreadPool;
+
+// 몬테카를로 재표본 설정
+struct MonteCarloConfig {
+    // BOOTSTRAP: 거래를 복원 추출 / BLOCK_BOOTSTRAP: 연속 blockSize개 거래 묶음을 복원 추출
+    // (연패 같은 자기상관 유지) / SHUFFLE: 같은 거래의 순서만 섞음 (총수익은 고정, 낙폭만 변함)
+    enum class Method { BOOTSTRAP, BLOCK_BOOTSTRAP, SHUFFLE };
+
+    Method method = Method::BOOTSTRAP;
+    size_t resamples = 10000;
+    size_t blockSize = 5;
+    uint64_t seed = 42;                     // 같은 시드면 스레드 수와 무관하게 같은 결과
+    double confidence = 0.95;               // 양측 신뢰구간
+    double ruinDrawdown = 20.0;             // 이 낙폭(%)에 닿은 경로를 파산으로 간주
+    double initialCapital = Backtester::INITIAL_CASH;
+};
+
+// 재표본 지표의 분포 요약
+struct MonteCarloDistribution {
+    double mean = 0.0;
+    double stdDev = 0.0;
+    double lower = 0.0;                     // 신뢰구간 하한 백분위
+    double median = 0.0;
+    double upper = 0.0;                     // 신뢰구간 상한 백분위
+    double min = 0.0;
+    double max = 0.0;
+};
+
+struct MonteCarloResult {
+    size_t resamples = 0;
+    size_t tradesPerPath = 0;
+    double confidence = 0.0;
+
+    MonteCarloDistribution totalReturn;     // %
+    MonteCarloDistribution maxDrawdown;     // % (고점 대비)
+    double riskOfRuin = 0.0;                // 낙폭이 ruinDrawdown에 닿은 경로 비율 (%)
+    double probabilityOfLoss = 0.0;         // 최종 손실 경로 비율 (%)
+
+    // 경로별 값 (재표본 번호순, CSV 저장용)
+    std::vector<double> returns;
+    std::vector<double> drawdowns;
+
+    double elapsedMs = 0.0;
+};
+
+// 거래 순서 재표본 몬테카를로
+// 기록된 거래의 손익(원)을 초기 자본에 순서대로 더해 경로를 만들고, 경로마다
+// 총수익률과 최대 낙폭을 잰다. 재표본은 구간으로 나눠 스레드 풀에서 병렬 처리하며,
+// 난수는 (시드, 재표본 번호, 추출 번호)를 해시하는 카운터 기반 생성기라서
+// 작업 분할/실행 순서와 무관하게 재현된다. 거래 간 보유 기간 겹침은 고려하지 않는다.
+class MonteCarloSimulator {
+public:
+    explicit MonteCarloSimulator(ThreadPool& pool);
+
+    MonteCarloResult run(const std::vector<BacktestTrade>& trades,
+                         const MonteCarloConfig& config) const;
+
+    // 경로별 총수익률/최대 낙폭을 CSV로 저장
+    static bool writePaths(const std::string& path, const MonteCarloResult& result);
+
+    // 카운터 기반 난수: 같은 (key, counter)는 항상 같은 64비트 값
+    static uint64_t counterRandom(uint64_t key, uint64_t counter);
+
+    // 분포 요약 (백분위는 정렬된 값 사이 선형 보간, 표준편차는 모표준편차)
+    static MonteCarloDistribution summarize(std::vector<double> values, double confidence);
+
+private:
+    ThreadPool& pool;
+
+    static void simulateRange(const std::vector<double>& pnl, const MonteCarloConfig& config,
+                              size_t first, size_t last, MonteCarloResult& out);
+};
+
+} // namespace yuanta
+
+#endif // MONTE_CARLO_H
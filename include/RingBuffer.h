@@ -0,0 +1,88 @@
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include "Span.h"
+#include <vector>
+#include <cstddef>
+
+namespace yuanta {
+
+// 고정 용량 링 버퍼
+// 생성 시 한 번만 할당하며, 가득 차면 가장 오래된 원소를 덮어쓴다.
+// 읽기는 복사 없이 최대 두 개의 연속 구간(RingView)으로 제공된다.
+template <typename T>
+class RingBuffer {
+public:
+    // 오래된 순서로 first → second 를 이어 읽으면 전체 구간이 된다
+    struct RingView {
+        Span<T> first;
+        Span<T> second;
+
+        size_t size() const { return first.size() + second.size(); }
+        bool empty() const { return size() == 0; }
+        const T& operator[](size_t i) const {
+            return i < first.size() ? first[i] : second[i - first.size()];
+        }
+        const T& back() const { return second.empty() ? first.back() : second.back(); }
+
+        // out 의 기존 용량을 재사용해 복사
+        void copyTo(std::vector<T>& out) const {
+            out.clear();
+            out.insert(out.end(), first.begin(), first.end());
+            out.insert(out.end(), second.begin(), second.end());
+        }
+    };
+
+    explicit RingBuffer(size_t capacity = 0) : buffer(capacity) {}
+
+    void push(const T& value) {
+        if (buffer.empty()) return;
+
+        buffer[head] = value;
+        head = (head + 1) % buffer.size();
+        if (count < buffer.size()) {
+            count++;
+        }
+    }
+
+    void clear() {
+        head = 0;
+        count = 0;
+    }
+
+    size_t size() const { return count; }
+    size_t capacity() const { return buffer.size(); }
+    bool empty() const { return count == 0; }
+
+    // i = 0 이 가장 오래된 원소
+    const T& operator[](size_t i) const {
+        return buffer[(head + buffer.size() - count + i) % buffer.size()];
+    }
+    const T& back() const { return (*this)[count - 1]; }
+
+    // 최근 n개에 대한 뷰 (n이 size()보다 크면 전체)
+    RingView latest(size_t n) const {
+        if (n > count) n = count;
+        if (n == 0) return RingView();
+
+        size_t start = (head + buffer.size() - n) % buffer.size();
+        const T* base = buffer.data();
+
+        if (start + n <= buffer.size()) {
+            return RingView{Span<T>(base + start, n), Span<T>()};
+        }
+        size_t firstLen = buffer.size() - start;
+        return RingView{Span<T>(base + start, firstLen), Span<T>(base, n - firstLen)};
+    }
+
+    RingView view() const { return latest(count); }
+
+private:
+    std::vector<T> buffer;
+    size_t head = 0;    // 다음 기록 위치
+    size_t count = 0;
+};
+
+} // namespace yuanta
+
+#endif // RING_BUFFER_H
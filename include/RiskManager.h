@@ -117,6 +117,9 @@ private:
     mutable std::mutex mtx;
 
     // 내부 함수
+    // mtx를 이미 잡은 상태에서 호출 (std::mutex는 재진입 불가)
+    double sumUnrealizedPnL() const;
+    bool dailyLossReached() const;
     double calculateCommission(double amount) const;
     double calculateTax(double amount) const;
     bool isMarketOpen() const;
@@ -0,0 +1,74 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <vector>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace yuanta {
+
+// 단일 생산자/단일 소비자 락프리 링 큐
+// 용량은 2의 거듭제곱으로 올림된다. tryPush는 생산자 스레드 하나에서만,
+// tryPop은 소비자 스레드 하나에서만 호출해야 한다.
+// 가득 차면 tryPush가 즉시 false를 반환하므로 생산자는 절대 블록되지 않는다.
+template <typename T>
+class SPSCQueue {
+public:
+    explicit SPSCQueue(size_t capacity) {
+        size_t cap = 2;
+        while (cap < capacity) cap <<= 1;
+        slots.resize(cap);
+        mask = cap - 1;
+    }
+
+    SPSCQueue(const SPSCQueue&) = delete;
+    SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+    // 생산자
+    bool tryPush(const T& value) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (t - cachedHead > mask) {
+            cachedHead = head.load(std::memory_order_acquire);
+            if (t - cachedHead > mask) return false;
+        }
+        slots[t & mask] = value;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 소비자
+    bool tryPop(T& out) {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h == cachedTail) {
+            cachedTail = tail.load(std::memory_order_acquire);
+            if (h == cachedTail) return false;
+        }
+        out = std::move(slots[h & mask]);
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 근사치 (다른 스레드가 동시에 변경 중일 수 있음)
+    size_t size() const {
+        size_t t = tail.load(std::memory_order_acquire);
+        size_t h = head.load(std::memory_order_acquire);
+        return t - h;
+    }
+    bool empty() const { return size() == 0; }
+    size_t capacity() const { return mask + 1; }
+
+private:
+    std::vector<T> slots;
+    size_t mask = 0;
+
+    // 생산자/소비자 인덱스를 서로 다른 캐시 라인에 배치 (false sharing 방지)
+    alignas(64) std::atomic<size_t> head{0};    // 소비자 소유
+    size_t cachedTail = 0;                      // 소비자 전용
+    alignas(64) std::atomic<size_t> tail{0};    // 생산자 소유
+    size_t cachedHead = 0;                      // 생산자 전용
+};
+
+} // namespace yuanta
+
+#endif // SPSC_QUEUE_H
@@ -0,0 +1,77 @@
+#ifndef SEQ_LOCK_H
+#define SEQ_LOCK_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace yuanta {
+
+// 시퀀스 락 기반 스냅샷 슬롯
+// 쓰기는 시퀀스를 홀수로 올리고 값을 기록한 뒤 짝수로 올린다. 읽기는 락 없이
+// 값을 복사하고 시퀀스가 그대로면 성공, 아니면 다시 읽는다. 읽기 측은 쓰기를
+// 절대 막지 않는다. 값은 64비트 원자 워드로 저장하므로 동시 읽기/쓰기가
+// 데이터 경쟁이 되지 않는다. 쓰기는 한 번에 한 스레드만 수행해야 한다.
+template <typename T>
+class SeqLock {
+    static_assert(std::is_trivially_copyable<T>::value, "SeqLock requires a trivially copyable type");
+
+public:
+    SeqLock() {
+        for (auto& w : words) w.store(0, std::memory_order_relaxed);
+    }
+
+    SeqLock(const SeqLock&) = delete;
+    SeqLock& operator=(const SeqLock&) = delete;
+
+    // 쓰기 (단일 작성자)
+    void store(const T& value) {
+        uint64_t buffer[WORD_COUNT] = {};
+        std::memcpy(buffer, &value, sizeof(T));
+
+        uint64_t s = seq.load(std::memory_order_relaxed);
+        seq.store(s + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        for (size_t i = 0; i < WORD_COUNT; ++i) {
+            words[i].store(buffer[i], std::memory_order_relaxed);
+        }
+
+        seq.store(s + 2, std::memory_order_release);
+    }
+
+    // 읽기 (한 번도 기록되지 않았으면 false)
+    bool load(T& out) const {
+        uint64_t buffer[WORD_COUNT];
+
+        while (true) {
+            uint64_t s1 = seq.load(std::memory_order_acquire);
+            if (s1 == 0) return false;
+            if (s1 & 1) continue;   // 기록 중
+
+            for (size_t i = 0; i < WORD_COUNT; ++i) {
+                buffer[i] = words[i].load(std::memory_order_relaxed);
+            }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (seq.load(std::memory_order_relaxed) == s1) break;
+        }
+
+        std::memcpy(&out, buffer, sizeof(T));
+        return true;
+    }
+
+    // 기록 횟수 (변경 감지용)
+    uint64_t version() const { return seq.load(std::memory_order_acquire) / 2; }
+
+private:
+    static constexpr size_t WORD_COUNT = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    std::atomic<uint64_t> seq{0};
+    std::atomic<uint64_t> words[WORD_COUNT];
+};
+
+} // namespace yuanta
+
+#endif // SEQ_LOCK_H
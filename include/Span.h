@@ -0,0 +1,47 @@
+#ifndef SPAN_H
+#define SPAN_H
+
+#include <cstddef>
+#include <vector>
+
+namespace yuanta {
+
+// 연속 메모리에 대한 비소유 읽기 전용 뷰 (C++17용 std::span 대체)
+// 원본 컨테이너가 살아 있고 변경되지 않는 동안에만 유효하다.
+template <typename T>
+class Span {
+public:
+    Span() = default;
+    Span(const T* data, size_t size) : ptr(data), count(size) {}
+    Span(const std::vector<T>& vec) : ptr(vec.data()), count(vec.size()) {}
+
+    const T* data() const { return ptr; }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    const T& operator[](size_t i) const { return ptr[i]; }
+    const T& front() const { return ptr[0]; }
+    const T& back() const { return ptr[count - 1]; }
+
+    const T* begin() const { return ptr; }
+    const T* end() const { return ptr + count; }
+
+    // 부분 뷰
+    Span subspan(size_t offset, size_t length) const {
+        if (offset > count) offset = count;
+        if (length > count - offset) length = count - offset;
+        return Span(ptr + offset, length);
+    }
+    Span first(size_t length) const { return subspan(0, length); }
+    Span last(size_t length) const {
+        return length >= count ? *this : Span(ptr + (count - length), length);
+    }
+
+private:
+    const T* ptr = nullptr;
+    size_t count = 0;
+};
+
+} // namespace yuanta
+
+#endif // SPAN_H
@@ -2,11 +2,16 @@
 #define STRATEGY_H
 
 #include "TechnicalIndicators.h"
+#include "IndicatorCache.h"
 #include "RiskManager.h"
 #include "YuantaAPI.h"
 #include <string>
 #include <memory>
 #include <functional>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
 
 namespace yuanta {
 
@@ -30,6 +35,7 @@ struct SignalInfo {
     double takeProfit2 = 0.0;
     double confidence = 0.0;    // 신뢰도 (0~1)
     std::string reason;
+    std::string strategy;       // 신호를 낸 전략 (StrategyManager가 기록)
 };
 
 // 전략 기본 클래스
@@ -40,16 +46,35 @@ public:
     // 전략 이름
     virtual std::string getName() const = 0;
 
-    // 신호 생성
-    virtual SignalInfo analyze(const std::string& code,
-                               const std::vector<OHLCV>& candles,
+    // 신호 생성 (같은 봉의 지표를 다른 전략과 공유)
+    virtual SignalInfo analyze(const IndicatorContext& ctx,
                                const QuoteData& quote) = 0;
 
+    // 신호 생성 (캔들만 주어진 경우 임시 컨텍스트 사용, 봉은 복사하지 않음)
+    // closes를 주면 종가 추출도 생략한다 (candles와 같은 구간이어야 함).
+    SignalInfo analyze(const std::string& code,
+                       Span<OHLCV> candles,
+                       const QuoteData& quote) {
+        IndicatorContext ctx(code, 1, candles);
+        return analyze(ctx, quote);
+    }
+    SignalInfo analyze(const std::string& code,
+                       Span<OHLCV> candles,
+                       Span<double> closes,
+                       const QuoteData& quote) {
+        IndicatorContext ctx(code, 1, candles, closes);
+        return analyze(ctx, quote);
+    }
+
     // 청산 조건 확인
     virtual bool shouldClose(const Position& position,
                              const QuoteData& quote) = 0;
 
-    // 전략 활성화/비활성화
+    // 백테스트에서 전 구간을 미리 계산해 둘 지표 (현재 파라미터 기준)
+    // 여기 없는 지표는 analyze에서 요청될 때 lookback 구간으로 계산된다.
+    virtual std::vector<IndicatorKey> requiredIndicators() const { return {}; }
+
+    // 전략 활성화/비활성화 (평가 스레드 밖에서 바꿔도 됨)
     void setEnabled(bool enabled) { this->enabled = enabled; }
     bool isEnabled() const { return enabled; }
 
@@ -57,8 +82,18 @@ public:
     virtual void setParameter(const std::string& name, double value) {}
     virtual double getParameter(const std::string& name) const { return 0.0; }
 
+    // setParameter가 인식하는 파라미터 이름 (최적화 범위 검증용)
+    virtual std::vector<std::string> parameterNames() const { return {}; }
+    bool hasParameter(const std::string& name) const {
+        auto names = parameterNames();
+        return std::find(names.begin(), names.end(), name) != names.end();
+    }
+
+    // 현재 파라미터로 신호를 내는 데 필요한 최소 봉 수 (백테스트 lookback 산정용)
+    virtual size_t minimumBars() const { return 0; }
+
 protected:
-    bool enabled = true;
+    std::atomic<bool> enabled{true};
     RiskManager* riskManager = nullptr;
 };
 
@@ -69,8 +104,8 @@ public:
 
     std::string getName() const override { return "GapPullback"; }
 
-    SignalInfo analyze(const std::string& code,
-                       const std::vector<OHLCV>& candles,
+    using Strategy::analyze;
+    SignalInfo analyze(const IndicatorContext& ctx,
                        const QuoteData& quote) override;
 
     bool shouldClose(const Position& position,
@@ -78,6 +113,8 @@ public:
 
     void setParameter(const std::string& name, double value) override;
     double getParameter(const std::string& name) const override;
+    std::vector<std::string> parameterNames() const override;
+    size_t minimumBars() const override;
 
 private:
     // 파라미터
@@ -90,15 +127,15 @@ private:
     double stopLossPercent = 1.0;    // 손절률 (%)
     int entryWindowMinutes = 15;     // 진입 시간 윈도우 (장 시작 후)
 
-    // 내부 상태
-    std::map<std::string, double> morningHighs;      // 아침 고점
-    std::map<std::string, bool> pullbackDetected;    // 눌림 감지 여부
+    // 내부 상태 (SymbolId 인덱스, 0 = 미기록)
+    std::vector<double> morningHighs;      // 아침 고점
+    std::vector<char> pullbackDetected;    // 눌림 감지 여부
 
     // 헬퍼 함수
     bool checkGapUp(const QuoteData& quote, double prevClose) const;
-    bool checkPullback(const std::string& code, double currentPrice) const;
-    bool checkVolume(const std::vector<OHLCV>& candles) const;
-    bool checkVWAP(double currentPrice, const std::vector<OHLCV>& candles) const;
+    bool checkPullback(SymbolId id, double currentPrice) const;
+    bool checkVolume(Span<OHLCV> candles) const;
+    bool checkVWAP(double currentPrice, const IndicatorContext& ctx) const;
     bool isWithinEntryWindow() const;
 };
 
@@ -109,8 +146,8 @@ public:
 
     std::string getName() const override { return "MABreakout"; }
 
-    SignalInfo analyze(const std::string& code,
-                       const std::vector<OHLCV>& candles,
+    using Strategy::analyze;
+    SignalInfo analyze(const IndicatorContext& ctx,
                        const QuoteData& quote) override;
 
     bool shouldClose(const Position& position,
@@ -118,6 +155,10 @@ public:
 
     void setParameter(const std::string& name, double value) override;
     double getParameter(const std::string& name) const override;
+    std::vector<std::string> parameterNames() const override;
+    size_t minimumBars() const override;
+
+    std::vector<IndicatorKey> requiredIndicators() const override;
 
 private:
     // 파라미터
@@ -132,10 +173,8 @@ private:
     double stopLossPercent = 1.2;    // 손절률
 
     // 헬퍼 함수
-    bool checkMAAlignment(const std::vector<double>& ma5,
-                          const std::vector<double>& ma10,
-                          const std::vector<double>& ma20) const;
-    bool checkMABreakout(double price, const std::vector<double>& ma20) const;
+    bool checkMAAlignment(Span<double> ma5, Span<double> ma10, Span<double> ma20) const;
+    bool checkMABreakout(double price, Span<double> ma20) const;
     bool checkRSI(double rsi) const;
     bool checkMACDCross(const MACDResult& macd) const;
 };
@@ -147,8 +186,8 @@ public:
 
     std::string getName() const override { return "BBSqueeze"; }
 
-    SignalInfo analyze(const std::string& code,
-                       const std::vector<OHLCV>& candles,
+    using Strategy::analyze;
+    SignalInfo analyze(const IndicatorContext& ctx,
                        const QuoteData& quote) override;
 
     bool shouldClose(const Position& position,
@@ -156,6 +195,10 @@ public:
 
     void setParameter(const std::string& name, double value) override;
     double getParameter(const std::string& name) const override;
+    std::vector<std::string> parameterNames() const override;
+    size_t minimumBars() const override;
+
+    std::vector<IndicatorKey> requiredIndicators() const override;
 
 private:
     // 파라미터
@@ -169,11 +212,20 @@ private:
     double stopLossPercent = 1.5;
 
     // 헬퍼 함수
-    bool checkSqueeze(const std::vector<BollingerBands>& bands) const;
+    bool checkSqueeze(Span<BollingerBands> bands) const;
     bool checkBreakout(double price, const BollingerBands& bb) const;
     double calculateTarget(const BollingerBands& bb, double atr) const;
 };
 
+// 전략 상태 (대시보드/상태 출력용 복사본)
+struct StrategyStatus {
+    std::string name;
+    bool enabled = false;
+    long long signalCount = 0;      // 낸 진입 신호 수
+    std::string lastSignalCode;
+    std::string lastSignalReason;
+};
+
 // 전략 매니저
 class StrategyManager {
 public:
@@ -185,10 +237,23 @@ public:
     void removeStrategy(const std::string& name);
     Strategy* getStrategy(const std::string& name);
 
-    // 모든 전략 분석 실행
+    // 모든 전략 분석 실행 (지표는 종목·주기별 캐시에서 공유)
     std::vector<SignalInfo> analyzeAll(const std::string& code,
                                         const std::vector<OHLCV>& candles,
-                                        const QuoteData& quote);
+                                        const QuoteData& quote,
+                                        int timeframe = 1);
+
+    // 분봉 완성 알림 (해당 종목·주기의 지표 캐시 무효화)
+    void onCandleComplete(const std::string& code, int timeframe);
+
+    // 봉이 마감된 종목들의 지표를 BatchIndicators로 한 번에 계산해 캐시에 게시
+    // 활성 전략이 요구하는 SMA/EMA/RSI/ATR/볼린저만 일괄 계산하고 (MACD/VWAP는 지연 계산),
+    // 이후 같은 봉으로 analyzeAll을 부르면 게시된 컨텍스트를 그대로 쓴다.
+    // 반환: 게시한 컨텍스트 수
+    size_t precomputeIndicators(const std::vector<std::string>& codes,
+                                const std::vector<std::vector<OHLCV>>& candles,
+                                int timeframe = 1);
+    IndicatorCache& getIndicatorCache() { return indicatorCache; }
 
     // 청산 조건 확인
     std::vector<SignalInfo> checkCloseConditions(
@@ -198,9 +263,15 @@ public:
     // 리스크 매니저 설정
     void setRiskManager(RiskManager* rm);
 
+    // 전략별 상태 스냅샷 (평가 스레드가 analyzeAll에서 갱신, 다른 스레드는 복사본만 읽음)
+    std::vector<StrategyStatus> getStatusSnapshot() const;
+
 private:
     std::vector<std::unique_ptr<Strategy>> strategies;
+    std::vector<StrategyStatus> status;     // strategies와 같은 순서
+    mutable std::mutex statusMutex;
     RiskManager* riskManager = nullptr;
+    IndicatorCache indicatorCache;
 };
 
 } // namespace yuanta
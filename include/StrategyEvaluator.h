@@ -0,0 +1,67 @@
+#ifndef STRATEGY_EVALUATOR_H
+#define STRATEGY_EVALUATOR_H
+
+#include <string>
+#include <deque>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include "SymbolRegistry.h"
+
+namespace yuanta {
+
+// 이벤트 기반 전략 평가 스테이지
+// 시세 수신/분봉 완성 시 notify()로 종목을 넣으면 전용 스레드가 새 데이터가 있는
+// 종목만 평가한다. 이미 대기 중인 종목은 한 번으로 합쳐지고, 평가 중에 들어온
+// 알림은 평가가 끝난 뒤 다시 처리된다.
+class StrategyEvaluator {
+public:
+    using EvaluateHandler = std::function<void(const std::string& code)>;
+
+    StrategyEvaluator();
+    ~StrategyEvaluator();
+
+    // 평가 함수 설정 (start 전에 호출)
+    void setHandler(EvaluateHandler handler);
+
+    // 평가 스레드 시작/중지
+    // stop은 진행 중인 평가가 끝나길 기다리고, 남은 대기열은 평가하지 않고 비운다.
+    void start();
+    void stop();
+    bool isRunning() const;
+
+    // 새 데이터 알림 (ID 버전은 문자열 조회 없이 처리)
+    void notify(SymbolId id);
+    void notify(const std::string& code);
+
+    // 통계
+    size_t getPendingCount() const;
+    long long getEvaluationCount() const;
+    long long getCoalescedCount() const;
+
+private:
+    EvaluateHandler handler;
+
+    // 대기열 (FIFO + SymbolId 인덱스 대기 플래그)
+    std::deque<SymbolId> queue;
+    std::vector<char> pending;
+    mutable std::mutex queueMutex;
+    std::condition_variable cv;
+
+    // 처리 스레드
+    std::atomic<bool> running{false};
+    std::thread evaluationThread;
+
+    // 통계
+    std::atomic<long long> evaluationCount{0};
+    std::atomic<long long> coalescedCount{0};
+
+    void processLoop();
+};
+
+} // namespace yuanta
+
+#endif // STRATEGY_EVALUATOR_H
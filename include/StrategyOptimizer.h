@@ -0,0 +1,120 @@
+#ifndef STRATEGY_OPTIMIZER_H
+#define STRATEGY_OPTIMIZER_H
+
+#include "Backtester.h"
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdint>
+
+namespace yuanta {
+
+class ThreadPool;
+
+// 파라미터 탐색 범위 [minValue, maxValue], step 간격
+struct ParameterRange {
+    std::string name;
+    double minValue = 0.0;
+    double maxValue = 0.0;
+    double step = 1.0;
+};
+
+using ParameterSet = std::map<std::string, double>;
+
+// 최적화 설정
+struct OptimizerConfig {
+    enum class Mode { GRID, RANDOM };
+    enum class RankBy { SHARPE, PROFIT_FACTOR, DRAWDOWN };
+
+    std::string strategyName;
+    std::vector<std::string> codes;         // 비어 있으면 로드된 전 종목
+    std::vector<ParameterRange> ranges;
+
+    Mode mode = Mode::GRID;
+    size_t randomSamples = 1000;            // RANDOM 모드 조합 수
+    uint64_t seed = 42;                     // RANDOM 모드 시드 (재현 가능)
+    size_t maxCombinations = 100000;        // GRID 조합 수 상한
+
+    RankBy rankBy = RankBy::SHARPE;
+    int minTrades = 10;                     // 이보다 거래가 적은 조합은 순위 뒤로
+};
+
+// 워크포워드 설정: inSampleDays일로 최적화하고 바로 뒤 outOfSampleDays일로 검증,
+// stepDays일씩 밀며 반복 (거래일 = 봉 시각의 KST 일자, DayIndex 기준)
+struct WalkForwardConfig {
+    OptimizerConfig optimizer;
+    size_t inSampleDays = 60;
+    size_t outOfSampleDays = 20;
+    size_t stepDays = 0;                    // 0 = outOfSampleDays (검증 구간이 겹치지 않음)
+    size_t warmupDays = 1;                  // 각 구간 앞 지표 준비 기간
+};
+
+// 조합별 평가 결과
+struct OptimizationResult {
+    ParameterSet parameters;
+    BacktestResult result;
+    double score = 0.0;                     // 클수록 좋음 (순위 기준 지표)
+};
+
+// 워크포워드 구간별 결과
+struct WalkForwardWindow {
+    size_t inSampleStart = 0;               // 거래일 번호
+    size_t outOfSampleStart = 0;
+    size_t outOfSampleDays = 0;
+    ParameterSet parameters;                // 학습 구간 최적 파라미터
+    BacktestResult inSample;
+    BacktestResult outOfSample;
+};
+
+struct WalkForwardResult {
+    std::vector<WalkForwardWindow> windows;
+    std::vector<BacktestTrade> trades;                      // 검증 구간 거래
+    std::vector<std::pair<long long, double>> equityCurve;  // 검증 구간 자산 곡선 (복리 연결)
+    BacktestResult aggregate;                               // 검증 구간 통합 결과 (수익률은 복리 연결)
+};
+
+// 전략 파라미터 최적화 (그리드/무작위 탐색)
+// 조합마다 백테스트 작업을 만들어 스레드 풀에서 병렬 평가하며,
+// 이력 데이터는 data 백테스터의 것을 복사 없이 공유한다.
+class StrategyOptimizer {
+public:
+    StrategyOptimizer(const Backtester& data, ThreadPool& pool);
+
+    // 평가 후 순위순으로 정렬된 결과 반환 (동점이면 조합 생성 순)
+    std::vector<OptimizationResult> optimize(const OptimizerConfig& config) const;
+
+    // 워크포워드 분석
+    // 모든 구간의 학습 조합을 한 번에 병렬 평가한 뒤, 구간별 최적 파라미터로
+    // 검증 구간들을 다시 병렬 평가한다. 이력은 구간별로 잘라 쓸 뿐 복사하지 않는다.
+    WalkForwardResult walkForward(const WalkForwardConfig& config) const;
+
+    // 결과 표를 CSV로 저장
+    static bool writeResults(const std::string& path,
+                             const std::vector<OptimizationResult>& results);
+    static bool writeWalkForward(const std::string& path, const WalkForwardResult& result);
+
+    // 조합 생성
+    static std::vector<ParameterSet> gridCombinations(const std::vector<ParameterRange>& ranges,
+                                                      size_t maxCombinations);
+    static std::vector<ParameterSet> randomCombinations(const std::vector<ParameterRange>& ranges,
+                                                        size_t count, uint64_t seed);
+
+    static double score(const BacktestResult& result, OptimizerConfig::RankBy rankBy);
+
+    // 점수를 매기고 순위순으로 정렬 (최소 거래 수를 채운 조합 우선, 동점이면 기존 순서)
+    static void rank(std::vector<OptimizationResult>& results, const OptimizerConfig& config);
+
+    // 전략이 모르는 파라미터 이름이 범위에 있으면 false (목록을 출력)
+    static bool validateRanges(const std::string& strategyName,
+                               const std::vector<ParameterRange>& ranges);
+
+private:
+    const Backtester& data;
+    ThreadPool& pool;
+
+    std::vector<ParameterSet> combinations(const OptimizerConfig& config) const;
+};
+
+} // namespace yuanta
+
+#endif // STRATEGY_OPTIMIZER_H
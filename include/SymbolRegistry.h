@@ -0,0 +1,57 @@
+#ifndef SYMBOL_REGISTRY_H
+#define SYMBOL_REGISTRY_H
+
+#include <string>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <atomic>
+#include <cstdint>
+
+namespace yuanta {
+
+// 종목 정수 ID (0부터 조밀하게 부여, 배열 인덱스로 사용)
+using SymbolId = uint32_t;
+const SymbolId INVALID_SYMBOL_ID = 0xFFFFFFFFu;
+
+// 종목코드 인터닝 레지스트리
+// 관심종목 등록 시 코드를 한 번 인터닝해 두고, 시세 처리 경로에서는
+// 문자열 해시/비교 대신 SymbolId로 평탄 배열을 바로 인덱싱한다.
+// 코드 문자열은 고정 크기 배열에 저장되어 주소가 바뀌지 않으므로
+// code(id)는 락 없이 읽을 수 있다.
+class SymbolRegistry {
+public:
+    static constexpr size_t MAX_SYMBOLS = 4096;
+
+    static SymbolRegistry& instance();
+
+    // 등록 (이미 있으면 기존 ID, 용량 초과 시 INVALID_SYMBOL_ID)
+    SymbolId intern(const std::string& code);
+
+    // 조회 (없으면 INVALID_SYMBOL_ID)
+    SymbolId find(const std::string& code) const;
+
+    // ID → 종목코드 (잘못된 ID면 빈 문자열)
+    const std::string& code(SymbolId id) const;
+
+    bool isValid(SymbolId id) const { return id < count.load(std::memory_order_acquire); }
+    size_t size() const { return count.load(std::memory_order_acquire); }
+
+    SymbolRegistry(const SymbolRegistry&) = delete;
+    SymbolRegistry& operator=(const SymbolRegistry&) = delete;
+
+private:
+    SymbolRegistry();
+
+    std::unique_ptr<std::string[]> codes;
+    std::atomic<size_t> count{0};
+
+    // 조회는 공유 락 (조회끼리는 서로 막지 않음)
+    std::unordered_map<std::string, SymbolId> index;
+    mutable std::shared_mutex mtx;
+};
+
+} // namespace yuanta
+
+#endif // SYMBOL_REGISTRY_H
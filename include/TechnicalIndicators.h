@@ -8,6 +8,8 @@
 #include <cmath>
 #include <algorithm>
 #include <numeric>
+#include <type_traits>
+#include "Span.h"
 
 // Windows min/max 매크로 충돌 방지
 #ifdef _WIN32
@@ -19,8 +21,9 @@
 namespace yuanta {
 
 // OHLCV 데이터 구조체
+// 종목코드는 봉마다 두지 않고 시리즈(종목별 컨테이너) 단위로 관리한다.
+// 힙 할당이 없는 48바이트 POD라 대량 보관/memcpy/스캔에 유리하다.
 struct OHLCV {
-    std::string code;
     double open;
     double high;
     double low;
@@ -29,6 +32,9 @@ struct OHLCV {
     long long timestamp;
 };
 
+static_assert(std::is_trivially_copyable<OHLCV>::value, "OHLCV must stay trivially copyable");
+static_assert(sizeof(OHLCV) == 48, "OHLCV layout changed");
+
 // 볼린저 밴드 결과
 struct BollingerBands {
     double upper;
@@ -48,70 +54,71 @@ struct MACDResult {
 };
 
 // 지표 계산 클래스
+// 입력은 비소유 뷰라 std::vector나 더 긴 시리즈의 일부 구간을 복사 없이 넘길 수 있다.
 class TechnicalIndicators {
 public:
     // 단순 이동평균 (SMA)
-    static double SMA(const std::vector<double>& prices, int period);
-    static std::vector<double> SMAVector(const std::vector<double>& prices, int period);
+    static double SMA(Span<double> prices, int period);
+    static std::vector<double> SMAVector(Span<double> prices, int period);
 
     // 지수 이동평균 (EMA)
-    static double EMA(const std::vector<double>& prices, int period);
-    static std::vector<double> EMAVector(const std::vector<double>& prices, int period);
+    static double EMA(Span<double> prices, int period);
+    static std::vector<double> EMAVector(Span<double> prices, int period);
 
     // 가중 이동평균 (WMA)
-    static double WMA(const std::vector<double>& prices, int period);
+    static double WMA(Span<double> prices, int period);
 
     // VWAP (Volume Weighted Average Price)
-    static double VWAP(const std::vector<OHLCV>& candles);
-    static std::vector<double> VWAPVector(const std::vector<OHLCV>& candles);
+    static double VWAP(Span<OHLCV> candles);
+    static std::vector<double> VWAPVector(Span<OHLCV> candles);
 
     // RSI (Relative Strength Index)
-    static double RSI(const std::vector<double>& prices, int period = 14);
-    static std::vector<double> RSIVector(const std::vector<double>& prices, int period = 14);
+    static double RSI(Span<double> prices, int period = 14);
+    static std::vector<double> RSIVector(Span<double> prices, int period = 14);
 
     // MACD
-    static MACDResult MACD(const std::vector<double>& prices,
+    static MACDResult MACD(Span<double> prices,
                            int fastPeriod = 12, int slowPeriod = 26, int signalPeriod = 9);
-    static std::vector<MACDResult> MACDVector(const std::vector<double>& prices,
+    static std::vector<MACDResult> MACDVector(Span<double> prices,
                                                int fastPeriod = 12, int slowPeriod = 26,
                                                int signalPeriod = 9);
 
     // 볼린저 밴드
-    static BollingerBands BollingerBand(const std::vector<double>& prices,
+    static BollingerBands BollingerBand(Span<double> prices,
                                          int period = 20, double stdDev = 2.0);
-    static std::vector<BollingerBands> BollingerBandVector(const std::vector<double>& prices,
+    static std::vector<BollingerBands> BollingerBandVector(Span<double> prices,
                                                             int period = 20, double stdDev = 2.0);
 
     // ATR (Average True Range)
-    static double ATR(const std::vector<OHLCV>& candles, int period = 14);
-    static std::vector<double> ATRVector(const std::vector<OHLCV>& candles, int period = 14);
+    static double ATR(Span<OHLCV> candles, int period = 14);
+    static std::vector<double> ATRVector(Span<OHLCV> candles, int period = 14);
 
     // 표준편차
-    static double StdDev(const std::vector<double>& prices, int period);
+    static double StdDev(Span<double> prices, int period);
 
     // 정배열 확인 (MA1 > MA2 > MA3 ...)
-    static bool isMAAligned(const std::vector<double>& maValues);
+    static bool isMAAligned(Span<double> maValues);
 
     // 볼린저 스퀴즈 확인
-    static bool isBollingerSqueeze(const std::vector<BollingerBands>& bands,
+    static bool isBollingerSqueeze(Span<BollingerBands> bands,
                                     int lookback = 50, double percentile = 0.2);
 
     // 최고가/최저가
-    static double Highest(const std::vector<double>& prices, int period);
-    static double Lowest(const std::vector<double>& prices, int period);
+    static double Highest(Span<double> prices, int period);
+    static double Lowest(Span<double> prices, int period);
 
     // 변화율
-    static double ROC(const std::vector<double>& prices, int period);
+    static double ROC(Span<double> prices, int period);
 
     // 모멘텀
-    static double Momentum(const std::vector<double>& prices, int period);
+    static double Momentum(Span<double> prices, int period);
 
     // 스토캐스틱
     struct Stochastic {
         double k;
         double d;
     };
-    static Stochastic StochasticOscillator(const std::vector<OHLCV>& candles,
+    static Stochastic StochasticOscillator(Span<OHLCV> candles,
                                             int kPeriod = 14, int dPeriod = 3);
 
 private:
@@ -120,36 +127,127 @@ private:
 };
 
 // 실시간 지표 계산기 (스트리밍용)
+// 등록된 지표마다 누적 상태(이동합, Wilder 평균, EMA 값 등)를 유지하여
+// addPrice/addOHLCV 시 O(1)로 갱신하고, 조회 시에는 할당 없이 상태만 읽는다.
+// 등록되지 않은 파라미터로 조회하면 최초 1회 보관 중인 이력으로 상태를 만든다.
 class StreamingIndicators {
 public:
     StreamingIndicators();
 
+    // 지표 등록 (이미 쌓인 이력으로 상태 초기화)
+    // 조회 전에 등록해야 하며, 등록하지 않은 기간은 조회해도 계산되지 않는다.
+    void registerSMA(int period);
+    void registerEMA(int period);
+    void registerRSI(int period = 14);
+    void registerMACD(int fastPeriod = 12, int slowPeriod = 26, int signalPeriod = 9);
+    void registerBB(int period = 20);
+    void registerATR(int period = 14);
+
     // 데이터 추가
     void addPrice(double price, long long volume = 0);
     void addOHLCV(const OHLCV& candle);
 
-    // 실시간 지표 조회
+    // 실시간 지표 조회 (읽기 전용, 할당 없음)
+    // 등록하지 않았거나 데이터가 부족하면 준비 전 값 (0, RSI는 50)
+    // 여러 스레드가 동시에 조회해도 되지만 add/register/clear와는 함께 호출하면 안 된다.
     double getCurrentSMA(int period) const;
     double getCurrentEMA(int period) const;
     double getCurrentRSI(int period = 14) const;
     double getCurrentVWAP() const;
     MACDResult getCurrentMACD() const;
+    MACDResult getCurrentMACD(int fastPeriod, int slowPeriod, int signalPeriod) const;
     BollingerBands getCurrentBB(int period = 20, double stdDev = 2.0) const;
     double getCurrentATR(int period = 14) const;
 
-    // 데이터 클리어
+    // 데이터 클리어 (등록된 지표는 유지)
     void clear();
     void setMaxSize(size_t size);
 
 private:
+    // SMA/볼린저용 구간 합
+    struct WindowState {
+        int period;
+        double sum = 0.0;
+        double sumSq = 0.0;
+    };
+
+    // EMA (첫 값은 SMA로 시작)
+    struct EMAState {
+        int period;
+        double multiplier;
+        double value = 0.0;
+        double seedSum = 0.0;
+        int count = 0;
+
+        explicit EMAState(int p) : period(p), multiplier(2.0 / (p + 1)) {}
+        bool ready() const { return count >= period; }
+        void update(double x);
+    };
+
+    // RSI (Wilder 스무딩)
+    struct RSIState {
+        int period;
+        double prevPrice = 0.0;
+        double avgGain = 0.0;
+        double avgLoss = 0.0;
+        int count = 0;          // 누적된 변화량 개수
+        bool hasPrev = false;
+
+        void update(double price);
+        double value() const;
+    };
+
+    // MACD (fast/slow EMA + 시그널 EMA)
+    struct MACDState {
+        EMAState fast;
+        EMAState slow;
+        EMAState signal;
+        double macd = 0.0;
+        double prevMACD = 0.0;
+        double prevSignal = 0.0;
+        int signalCount = 0;
+
+        MACDState(int f, int s, int sig) : fast(f), slow(s), signal(sig) {}
+        void update(double price);
+        MACDResult value() const;
+    };
+
+    // ATR (True Range Wilder 스무딩)
+    struct ATRState {
+        int period;
+        double prevClose = 0.0;
+        double atr = 0.0;
+        int count = 0;          // 누적된 True Range 개수
+        bool hasPrev = false;
+
+        void update(const OHLCV& candle);
+    };
+
     std::deque<double> prices;
     std::deque<OHLCV> candles;
-    std::deque<double> volumes;
     size_t maxSize = 500;
 
-    // EMA 캐시
-    mutable std::map<int, double> emaCache;
-    mutable std::map<int, double> rsiCache;
+    // VWAP 구간 누적값
+    double windowTPV = 0.0;
+    double windowVolume = 0.0;
+    size_t updatesSinceRebuild = 0;
+
+    // 등록된 지표 상태 (register*에서만 추가)
+    std::vector<WindowState> windows;
+    std::vector<EMAState> emas;
+    std::vector<RSIState> rsis;
+    std::vector<MACDState> macds;
+    std::vector<ATRState> atrs;
+
+    // 등록된 상태 조회 (없으면 nullptr)
+    const WindowState* findWindow(int period) const;
+    const EMAState* findEMA(int period) const;
+    const RSIState* findRSI(int period) const;
+    const MACDState* findMACD(int fastPeriod, int slowPeriod, int signalPeriod) const;
+    const ATRState* findATR(int period) const;
+
+    void updatePriceStates(double price);
+    void rebuildWindows();
 };
 
 } // namespace yuanta
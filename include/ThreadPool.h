@@ -0,0 +1,81 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+
+namespace yuanta {
+
+// 작업 훔치기(work-stealing) 스레드 풀
+// 작업자마다 자기 대기열을 두고, 자기 대기열은 뒤에서(LIFO) 꺼내며
+// 비면 다른 작업자의 대기열 앞에서(FIFO) 훔쳐 온다.
+// 외부 스레드의 작업은 작업자 대기열에 돌아가며 배분하고, 작업 안에서 제출한
+// 작업은 현재 작업자의 대기열에 들어간다.
+class ThreadPool {
+public:
+    explicit ThreadPool(size_t threadCount = 0);   // 0 = 하드웨어 스레드 수
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // 작업 제출 (결과/예외는 future로 전달)
+    // 작업 안에서 다른 작업의 future를 기다리면 교착될 수 있다.
+    template <typename F>
+    auto submit(F&& task) -> std::future<decltype(task())>;
+
+    size_t size() const { return workers.size(); }
+
+    // 통계
+    long long getExecutedCount() const { return executedCount; }
+    long long getStealCount() const { return stealCount; }
+
+private:
+    using Task = std::function<void()>;
+
+    struct WorkerQueue {
+        std::deque<Task> tasks;
+        std::mutex mtx;
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::vector<std::thread> workers;
+
+    // 유휴 작업자 대기
+    std::mutex waitMutex;
+    std::condition_variable cv;
+    std::atomic<size_t> pendingTasks{0};
+    std::atomic<bool> stopping{false};
+    std::atomic<size_t> nextQueue{0};
+
+    // 통계
+    std::atomic<long long> executedCount{0};
+    std::atomic<long long> stealCount{0};
+
+    void enqueue(Task task);
+    bool popTask(size_t index, Task& task);
+    void workerLoop(size_t index);
+};
+
+template <typename F>
+auto ThreadPool::submit(F&& task) -> std::future<decltype(task())> {
+    using Result = decltype(task());
+
+    // std::function은 복사 가능해야 하므로 shared_ptr로 감쌈
+    auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(task));
+    std::future<Result> result = packaged->get_future();
+
+    enqueue([packaged]() { (*packaged)(); });
+    return result;
+}
+
+} // namespace yuanta
+
+#endif // THREAD_POOL_H
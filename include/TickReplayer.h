@@ -0,0 +1,131 @@
+#ifndef TICK_REPLAYER_H
+#define TICK_REPLAYER_H
+
+#include "Backtester.h"
+#include "MarketDataManager.h"
+#include "Strategy.h"
+#include "Clock.h"
+#include "FillModel.h"
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdint>
+#include <memory>
+#include <functional>
+
+namespace yuanta {
+
+// 기록된 체결 틱 (volume은 누적이 아닌 해당 체결량)
+struct ReplayTick {
+    long long timestamp = 0;
+    double price = 0.0;
+    long long volume = 0;
+    uint32_t symbol = 0;        // 종목 목록에서의 위치
+};
+
+// 리플레이 설정
+struct ReplayConfig {
+    std::vector<std::string> strategies;    // 비어 있으면 전 전략
+    std::map<std::string, double> parameters;   // 모든 전략에 setParameter로 적용
+    std::function<std::unique_ptr<Strategy>(const std::string&)> strategyFactory;  // nullptr = Backtester::createStrategy
+    int ticksPerBar = 4;                    // 분봉에서 합성할 때 봉당 틱 수 (시가→고/저→종가 경로)
+
+    DailyBudgetConfig budget;
+    std::shared_ptr<const FillModel> fillModel;     // nullptr = 기본 IntrabarFillModel
+
+    // 완성된 1분봉 관찰 (분봉 집계 검증/기록용, 리플레이 스레드에서 호출)
+    std::function<void(const std::string& code, const OHLCV& candle)> onMinuteCandle;
+    double commission = 0.00015;
+    double tax = 0.0023;
+};
+
+// 리플레이 결과
+struct ReplayResult {
+    BacktestResult result;
+    std::vector<BacktestTrade> trades;
+    std::vector<std::pair<long long, double>> equityCurve;
+    long long ticks = 0;                    // 처리한 틱 수
+    long long candles = 0;                  // 완성된 1분봉 수
+    long long evaluations = 0;              // 전략 평가 횟수
+    double elapsedMs = 0.0;
+};
+
+// 틱 리플레이 백테스트
+// 틱을 실거래와 같은 MarketDataManager::processQuote → 분봉 완성 콜백 →
+// StrategyManager::analyzeAll/checkCloseConditions 경로로 흘려 보낸다.
+// 수신 큐/평가 스레드 없이 한 스레드에서 최대 속도로 처리하며, 모의 시계는
+// 리플레이 동안 현재 스레드의 시계(currentClock)로 설치되어
+// 틱마다 틱 시각으로 맞춘다. 손절/익절은 StopLossMonitor처럼 틱마다 확인하며,
+// 체결 모델에는 틱을 가격 하나짜리 봉(거래량은 직전 1분봉)으로 넘긴다.
+class TickReplayer {
+public:
+    explicit TickReplayer(const ReplayConfig& config = ReplayConfig());
+
+    // 분봉 이력에서 합성한 틱으로 리플레이 (codes가 비어 있으면 전 종목)
+    ReplayResult replayBars(const BarHistory& history,
+                            const std::vector<std::string>& codes = {});
+
+    // 기록된 틱으로 리플레이 (ticks는 시각순, symbol은 codes의 위치)
+    ReplayResult replayTicks(const std::vector<std::string>& codes,
+                             const std::vector<ReplayTick>& ticks);
+
+    // 틱 CSV 로드: timestamp,code,price,volume (헤더 행 허용, 시각순이 아니면 정렬)
+    static bool loadTicks(const std::string& filepath,
+                          std::vector<std::string>& codes,
+                          std::vector<ReplayTick>& ticks);
+
+    // 리플레이 중 현재 시각 (마지막으로 처리한 틱 시각)
+    const Clock& getClock() const { return clock; }
+
+private:
+    ReplayConfig config;
+    SimulatedClock clock;
+
+    // 종목별 리플레이 상태 (종목 목록 위치로 인덱싱)
+    struct ReplaySymbol {
+        std::string code;
+        QuoteData quote;                // 틱마다 재사용 (문자열 할당 없음)
+        long long day = -1;             // 현재 거래일 (DayIndex::dayStart)
+        double lastPrice = 0.0;
+        long long barVolume = 0;        // 직전 완성 1분봉 거래량 (슬리피지 참여율 기준)
+
+        bool holding = false;
+        int quantity = 0;
+        double entryPrice = 0.0;
+        long long entryTime = 0;
+        double stopLoss = 0.0;
+        double takeProfit1 = 0.0;
+        double takeProfit2 = 0.0;
+        std::string strategy;
+    };
+
+    // 한 번의 리플레이 실행 상태
+    struct Session {
+        MarketDataManager dataManager;
+        StrategyManager strategyManager;
+        std::vector<ReplaySymbol> symbols;
+        bool minuteClosed = false;          // 이번 틱에서 1분봉이 완성됨
+        long long closedVolume = 0;         // 완성된 1분봉 거래량
+        std::vector<OHLCV> evalCandles;     // 평가용 버퍼 (재사용)
+
+        double cash = Backtester::INITIAL_CASH;
+        size_t openCount = 0;
+        long long lastDay = -1;
+        long long lastTime = 0;
+
+        ReplayResult out;
+    };
+
+    bool beginSession(Session& session, const std::vector<std::string>& codes);
+    void onTick(Session& session, uint32_t symbol, long long timestamp,
+                double price, long long volume);
+    void evaluate(Session& session, uint32_t symbol);
+    void exitPosition(Session& session, ReplaySymbol& sym, double fillPrice,
+                      long long timestamp, const char* reason);
+    void recordEquity(Session& session, long long timestamp);
+    void finishSession(Session& session);
+};
+
+} // namespace yuanta
+
+#endif // TICK_REPLAYER_H
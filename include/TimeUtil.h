@@ -0,0 +1,21 @@
+#ifndef TIME_UTIL_H
+#define TIME_UTIL_H
+
+#include <ctime>
+
+namespace yuanta {
+
+// 스레드 안전한 지역 시간 변환 (std::localtime은 스레드 간 정적 버퍼를 공유)
+inline std::tm toLocalTime(std::time_t t) {
+    std::tm result{};
+#ifdef _WIN32
+    localtime_s(&result, &t);
+#else
+    localtime_r(&t, &result);
+#endif
+    return result;
+}
+
+} // namespace yuanta
+
+#endif // TIME_UTIL_H
@@ -6,6 +6,7 @@
 #include <vector>
 #include <map>
 #include <memory>
+#include "SymbolRegistry.h"
 
 #ifdef _WIN32
 #ifndef NOMINMAX
@@ -40,6 +41,7 @@ enum MessageCommand {
 // 시세 데이터 구조체
 struct QuoteData {
     std::string code;           // 종목코드
+    SymbolId symbolId = INVALID_SYMBOL_ID;  // 인터닝된 종목 ID
     double currentPrice = 0;    // 현재가
     double openPrice = 0;       // 시가
     double highPrice = 0;       // 고가
@@ -54,6 +56,7 @@ struct QuoteData {
 // 호가 데이터 구조체
 struct OrderbookData {
     std::string code;
+    SymbolId symbolId = INVALID_SYMBOL_ID;
     double bidPrices[10] = {0}; // 매수호가
     double askPrices[10] = {0}; // 매도호가
     long long bidVolumes[10] = {0}; // 매수잔량
@@ -120,6 +123,13 @@ public:
     bool subscribeOrderbook(const std::string& code);
     bool subscribeTradeData(const std::string& code);
 
+    // 모의 시세 피드 (시뮬레이션 모드 전용)
+    // 구독한 종목마다 intervalMs 간격으로 랜덤워크 시세를 만들어 전용 스레드에서
+    // 시세 콜백을 호출한다. 콜백은 피드 시작 전에 설정해야 한다.
+    bool startSimulatedFeed(int intervalMs = 100);
+    void stopSimulatedFeed();
+    bool isSimulatedFeedRunning() const;
+
     // 데이터 조회
     std::vector<CandleData> getMinuteCandles(const std::string& code,
                                               int minutes, int count);
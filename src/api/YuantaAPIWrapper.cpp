@@ -3,6 +3,12 @@
 #include <cstring>
 #include <chrono>
 #include <cstdlib>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <random>
+#include <cmath>
+#include <algorithm>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -62,8 +68,37 @@ public:
     std::string accountNo;
     std::string userId;
     long startMsgId = WM_USER + 100;
+
+    // 모의 시세 피드
+    struct SimSymbol {
+        std::string code;
+        SymbolId symbolId = INVALID_SYMBOL_ID;
+        double prevClose = 0;
+        double open = 0;
+        double price = 0;
+        double high = 0;
+        double low = 0;
+        long long cumVolume = 0;
+    };
+    std::vector<SimSymbol> feedSymbols;
+    std::mutex feedMutex;
+    std::thread feedThread;
+    std::atomic<bool> feedRunning{false};
+    int feedIntervalMs = 100;
+
+    // TR 입력 블록은 TR 코드별로 DLL 안에 하나뿐이라서, 필드 설정부터 요청까지를
+    // 한 단위로 직렬화한다 (웜업 병렬 조회 중 종목 코드가 섞이지 않도록)
+    std::mutex trMutex;
 };
 
+// 시뮬레이션 기준가 (getCurrentQuote와 동일)
+static double simulatedBasePrice(const std::string& code) {
+    if (code == "005930") return 70000.0;
+    if (code == "000660") return 130000.0;
+    if (code == "035420") return 180000.0;
+    return 50000.0;
+}
+
 YuantaAPI::YuantaAPI()
     : pImpl(std::make_unique<Impl>())
     , hDll(nullptr)
@@ -236,6 +271,8 @@ bool YuantaAPI::login(const std::string& id, const std::string& password,
 }
 
 void YuantaAPI::disconnect() {
+    stopSimulatedFeed();
+
     if (connected) {
 #ifdef _WIN32
         if (!simulationMode && pImpl->fnUnRegistAllAuto) {
@@ -258,7 +295,26 @@ bool YuantaAPI::isConnected() const {
 bool YuantaAPI::subscribeQuote(const std::string& code) {
     if (!connected) return false;
 
+    // 실시간 수신 시 문자열 조회 없이 ID를 붙일 수 있도록 미리 인터닝
+    SymbolRegistry::instance().intern(code);
+
     if (simulationMode) {
+        std::lock_guard<std::mutex> lock(pImpl->feedMutex);
+        auto& symbols = pImpl->feedSymbols;
+        auto it = std::find_if(symbols.begin(), symbols.end(),
+            [&code](const Impl::SimSymbol& s) { return s.code == code; });
+        if (it == symbols.end()) {
+            Impl::SimSymbol sym;
+            sym.code = code;
+            sym.symbolId = SymbolRegistry::instance().find(code);
+            sym.prevClose = simulatedBasePrice(code) - 500;
+            sym.open = simulatedBasePrice(code);
+            sym.price = sym.open;
+            sym.high = sym.open;
+            sym.low = sym.open;
+            symbols.push_back(sym);
+        }
+
         std::cout << "[Simulation] Subscribed to quote: " << code << std::endl;
         return true;
     }
@@ -279,6 +335,11 @@ bool YuantaAPI::unsubscribeQuote(const std::string& code) {
     if (!connected) return false;
 
     if (simulationMode) {
+        std::lock_guard<std::mutex> lock(pImpl->feedMutex);
+        auto& symbols = pImpl->feedSymbols;
+        symbols.erase(std::remove_if(symbols.begin(), symbols.end(),
+            [&code](const Impl::SimSymbol& s) { return s.code == code; }), symbols.end());
+
         std::cout << "[Simulation] Unsubscribed from quote: " << code << std::endl;
         return true;
     }
@@ -369,6 +430,7 @@ std::vector<CandleData> YuantaAPI::getMinuteCandles(const std::string& code,
 #ifdef _WIN32
     // TR: 분봉 조회 (예: 250102)
     if (pImpl->fnSetTRFieldString && pImpl->fnRequest) {
+        std::lock_guard<std::mutex> lock(pImpl->trMutex);
         pImpl->fnSetTRFieldString("250102", "InBlock1", "jongcode", code.c_str(), 0);
         // 분 단위 설정
         char minStr[10];
@@ -420,6 +482,7 @@ std::vector<CandleData> YuantaAPI::getDailyCandles(const std::string& code, int
 #ifdef _WIN32
     // TR: 일봉 조회 (예: 250101)
     if (pImpl->fnSetTRFieldString && pImpl->fnRequest) {
+        std::lock_guard<std::mutex> lock(pImpl->trMutex);
         pImpl->fnSetTRFieldString("250101", "InBlock1", "jongcode", code.c_str(), 0);
         long reqId = pImpl->fnRequest(pImpl->hwnd, "250101", FALSE, -1);
     }
@@ -428,6 +491,88 @@ std::vector<CandleData> YuantaAPI::getDailyCandles(const std::string& code, int
     return candles;
 }
 
+bool YuantaAPI::startSimulatedFeed(int intervalMs) {
+    if (!simulationMode || !connected) return false;
+    if (pImpl->feedRunning) return true;
+
+    pImpl->feedIntervalMs = (std::max)(1, intervalMs);
+    pImpl->feedRunning = true;
+
+    pImpl->feedThread = std::thread([this]() {
+        std::mt19937 rng(42);  // 재현 가능한 결과
+        std::normal_distribution<double> step(0.0, 0.001);
+        std::uniform_int_distribution<int> tradeSize(1, 500);
+
+        while (pImpl->feedRunning) {
+            long long now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+
+            {
+                std::lock_guard<std::mutex> lock(pImpl->feedMutex);
+
+                for (auto& sym : pImpl->feedSymbols) {
+                    // 10원 단위 랜덤워크
+                    sym.price = std::round(sym.price * (1.0 + step(rng)) / 10.0) * 10.0;
+                    sym.high = (std::max)(sym.high, sym.price);
+                    sym.low = (std::min)(sym.low, sym.price);
+                    sym.cumVolume += tradeSize(rng);
+
+                    QuoteData quote;
+                    quote.code = sym.code;
+                    quote.symbolId = sym.symbolId;
+                    quote.currentPrice = sym.price;
+                    quote.openPrice = sym.open;
+                    quote.highPrice = sym.high;
+                    quote.lowPrice = sym.low;
+                    quote.prevClose = sym.prevClose;
+                    quote.volume = sym.cumVolume;
+                    quote.changeRate = ((sym.price - sym.prevClose) / sym.prevClose) * 100;
+                    quote.timestamp = now;
+
+                    if (quoteCallback) {
+                        quoteCallback(quote);
+                    }
+
+                    // 현재가 기준 10호가 (10원 단위)
+                    if (orderbookCallback) {
+                        OrderbookData orderbook;
+                        orderbook.code = sym.code;
+                        orderbook.symbolId = sym.symbolId;
+                        for (int level = 0; level < 10; ++level) {
+                            orderbook.askPrices[level] = sym.price + 10.0 * (level + 1);
+                            orderbook.bidPrices[level] = sym.price - 10.0 * level;
+                            orderbook.askVolumes[level] = tradeSize(rng) * 10;
+                            orderbook.bidVolumes[level] = tradeSize(rng) * 10;
+                        }
+                        orderbookCallback(orderbook);
+                    }
+                }
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(pImpl->feedIntervalMs));
+        }
+    });
+
+    std::cout << "[Simulation] Quote feed started (" << pImpl->feedIntervalMs
+              << "ms interval)" << std::endl;
+    return true;
+}
+
+void YuantaAPI::stopSimulatedFeed() {
+    if (!pImpl->feedRunning) return;
+
+    pImpl->feedRunning = false;
+    if (pImpl->feedThread.joinable()) {
+        pImpl->feedThread.join();
+    }
+
+    std::cout << "[Simulation] Quote feed stopped" << std::endl;
+}
+
+bool YuantaAPI::isSimulatedFeedRunning() const {
+    return pImpl->feedRunning;
+}
+
 QuoteData YuantaAPI::getCurrentQuote(const std::string& code) {
     QuoteData quote;
     quote.code = code;
@@ -456,6 +601,7 @@ QuoteData YuantaAPI::getCurrentQuote(const std::string& code) {
 #ifdef _WIN32
     // TR: 주식현재가 조회 (예: 300001)
     if (pImpl->fnSetTRFieldString && pImpl->fnRequest) {
+        std::lock_guard<std::mutex> lock(pImpl->trMutex);
         pImpl->fnSetTRFieldString("300001", "InBlock1", "jongcode", code.c_str(), 0);
         long reqId = pImpl->fnRequest(pImpl->hwnd, "300001", TRUE, -1);
     }
@@ -483,6 +629,7 @@ OrderResult YuantaAPI::buyMarket(const std::string& code, int quantity) {
 #ifdef _WIN32
     // TR: 현금매수 (시장가)
     if (pImpl->fnSetTRFieldString && pImpl->fnRequest) {
+        std::lock_guard<std::mutex> lock(pImpl->trMutex);
         // 주문 정보 설정
         pImpl->fnSetTRFieldString("160001", "InBlock1", "jongcode", code.c_str(), 0);
         char qtyStr[20];
@@ -521,6 +668,7 @@ OrderResult YuantaAPI::buyLimit(const std::string& code, int quantity, double pr
 
 #ifdef _WIN32
     if (pImpl->fnSetTRFieldString && pImpl->fnRequest) {
+        std::lock_guard<std::mutex> lock(pImpl->trMutex);
         pImpl->fnSetTRFieldString("160001", "InBlock1", "jongcode", code.c_str(), 0);
         char qtyStr[20], priceStr[20];
         sprintf_s(qtyStr, "%d", quantity);
@@ -558,6 +706,7 @@ OrderResult YuantaAPI::sellMarket(const std::string& code, int quantity) {
 
 #ifdef _WIN32
     if (pImpl->fnSetTRFieldString && pImpl->fnRequest) {
+        std::lock_guard<std::mutex> lock(pImpl->trMutex);
         pImpl->fnSetTRFieldString("160002", "InBlock1", "jongcode", code.c_str(), 0);
         char qtyStr[20];
         sprintf_s(qtyStr, "%d", quantity);
@@ -595,6 +744,7 @@ OrderResult YuantaAPI::sellLimit(const std::string& code, int quantity, double p
 
 #ifdef _WIN32
     if (pImpl->fnSetTRFieldString && pImpl->fnRequest) {
+        std::lock_guard<std::mutex> lock(pImpl->trMutex);
         pImpl->fnSetTRFieldString("160002", "InBlock1", "jongcode", code.c_str(), 0);
         char qtyStr[20], priceStr[20];
         sprintf_s(qtyStr, "%d", quantity);
@@ -625,6 +775,7 @@ bool YuantaAPI::cancelOrder(const std::string& orderId) {
 #ifdef _WIN32
     // TR: 주문취소
     if (pImpl->fnSetTRFieldString && pImpl->fnRequest) {
+        std::lock_guard<std::mutex> lock(pImpl->trMutex);
         pImpl->fnSetTRFieldString("160003", "InBlock1", "orgordno", orderId.c_str(), 0);
         long reqId = pImpl->fnRequest(pImpl->hwnd, "160003", TRUE, -1);
         return reqId > ERROR_MAX_CODE;
@@ -646,6 +797,7 @@ bool YuantaAPI::modifyOrder(const std::string& orderId, double newPrice, int new
 #ifdef _WIN32
     // TR: 주문정정
     if (pImpl->fnSetTRFieldString && pImpl->fnRequest) {
+        std::lock_guard<std::mutex> lock(pImpl->trMutex);
         pImpl->fnSetTRFieldString("160004", "InBlock1", "orgordno", orderId.c_str(), 0);
         char qtyStr[20], priceStr[20];
         sprintf_s(qtyStr, "%d", newQty);
@@ -671,6 +823,7 @@ double YuantaAPI::getBalance() {
 #ifdef _WIN32
     // TR: 예수금 조회
     if (pImpl->fnRequest) {
+        std::lock_guard<std::mutex> lock(pImpl->trMutex);
         long reqId = pImpl->fnRequest(pImpl->hwnd, "170001", TRUE, -1);
     }
 #endif
@@ -705,6 +858,7 @@ std::map<std::string, int> YuantaAPI::getPositions() {
 #ifdef _WIN32
     // TR: 잔고 조회
     if (pImpl->fnRequest) {
+        std::lock_guard<std::mutex> lock(pImpl->trMutex);
         long reqId = pImpl->fnRequest(pImpl->hwnd, "170002", TRUE, -1);
     }
 #endif
@@ -1,530 +1,490 @@
-#include "../../include/TechnicalIndicators.h"
-#include "../../include/RiskManager.h"
-#include "../../include/Strategy.h"
-#include "../../include/MarketDataManager.h"
+#include "../../include/Backtester.h"
+#include "../../include/StrategyOptimizer.h"
+#include "../../include/ThreadPool.h"
+#include "../../include/TickReplayer.h"
+#include "../../include/MonteCarlo.h"
 
 #include <iostream>
 #include <fstream>
-#include <sstream>
 #include <iomanip>
-#include <cmath>
-#include <algorithm>
-#include <map>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdlib>
 
 using namespace yuanta;
 
-// 백테스트 결과 구조체
-struct BacktestResult {
-    double totalReturn = 0.0;
-    double annualizedReturn = 0.0;
-    double maxDrawdown = 0.0;
-    double sharpeRatio = 0.0;
-    double winRate = 0.0;
-    double profitFactor = 0.0;
-    int totalTrades = 0;
-    int winTrades = 0;
-    int lossTrades = 0;
-    double avgWin = 0.0;
-    double avgLoss = 0.0;
-    double avgHoldingPeriod = 0.0;  // 분 단위
-};
-
-// 백테스트 거래 기록
-struct BacktestTrade {
-    std::string code;
-    long long entryTime;
-    long long exitTime;
-    double entryPrice;
-    double exitPrice;
-    int quantity;
-    double pnl;
-    double pnlPercent;
-    std::string strategy;
-    std::string exitReason;
-};
-
-// 백테스터 클래스
-class Backtester {
-public:
-    Backtester() {
-        // 기본 설정
-        config.dailyBudget = 10000000.0;
-        config.maxPositionRatio = 0.20;
-        config.maxDailyLossRatio = 0.03;
-        config.maxConcurrentPositions = 3;
-
-        // 거래 비용 설정
-        slippage = 0.001;      // 0.1%
-        commission = 0.00015;  // 0.015%
-        tax = 0.0023;          // 0.23%
-    }
-
-    // 데이터 로드
-    bool loadData(const std::string& filepath, const std::string& code) {
-        std::ifstream file(filepath);
-        if (!file.is_open()) {
-            std::cerr << "Failed to open: " << filepath << std::endl;
-            return false;
-        }
-
-        std::vector<OHLCV> candles;
-        std::string line;
-
-        // 헤더 스킵
-        std::getline(file, line);
-
-        while (std::getline(file, line)) {
-            std::stringstream ss(line);
-            std::string token;
-            OHLCV candle;
-            candle.code = code;
-
-            int col = 0;
-            while (std::getline(ss, token, ',')) {
-                try {
-                    switch (col) {
-                        case 0: candle.timestamp = std::stoll(token); break;
-                        case 1: candle.open = std::stod(token); break;
-                        case 2: candle.high = std::stod(token); break;
-                        case 3: candle.low = std::stod(token); break;
-                        case 4: candle.close = std::stod(token); break;
-                        case 5: candle.volume = std::stoll(token); break;
-                    }
-                } catch (...) {
-                    continue;
-                }
-                col++;
-            }
+void printResults(const BacktestResult& result, const std::string& strategyName) {
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "  Backtest Results: " << strategyName << std::endl;
+    std::cout << "========================================\n" << std::endl;
 
-            if (col >= 6) {
-                candles.push_back(candle);
-            }
-        }
+    std::cout << std::fixed << std::setprecision(2);
 
-        historicalData[code] = candles;
-        std::cout << "Loaded " << candles.size() << " candles for " << code << std::endl;
-        return true;
-    }
+    std::cout << "Performance Metrics:" << std::endl;
+    std::cout << "  Total Return:       " << result.totalReturn << "%" << std::endl;
+    std::cout << "  Annualized Return:  " << result.annualizedReturn << "%" << std::endl;
+    std::cout << "  Max Drawdown:       " << result.maxDrawdown << "%" << std::endl;
+    std::cout << "  Sharpe Ratio:       " << result.sharpeRatio << std::endl;
+    std::cout << std::endl;
 
-    // 시뮬레이션 데이터 생성
-    void generateSimulatedData(const std::string& code, int days = 180) {
-        std::vector<OHLCV> candles;
+    std::cout << "Trade Statistics:" << std::endl;
+    std::cout << "  Total Trades:       " << result.totalTrades << std::endl;
+    std::cout << "  Winning Trades:     " << result.winTrades << std::endl;
+    std::cout << "  Losing Trades:      " << result.lossTrades << std::endl;
+    std::cout << "  Win Rate:           " << result.winRate << "%" << std::endl;
+    std::cout << "  Profit Factor:      " << result.profitFactor << std::endl;
+    std::cout << std::endl;
 
-        // 분봉 데이터 생성 (하루 390분)
-        int candlesPerDay = 390;
-        int totalCandles = days * candlesPerDay;
+    std::cout << "Average Trade:" << std::endl;
+    std::cout << "  Avg Win:            " << std::setprecision(0) << result.avgWin << " KRW" << std::endl;
+    std::cout << "  Avg Loss:           " << result.avgLoss << " KRW" << std::endl;
+    std::cout << "  Avg Holding Time:   " << std::setprecision(1) << result.avgHoldingPeriod << " min" << std::endl;
 
-        double basePrice = 50000.0;
-        long long baseTime = 1704067200000LL;  // 2024-01-01
+    std::cout << "\n========================================\n" << std::endl;
+}
 
-        srand(42);  // 재현 가능한 결과
+// "이름=최소:최대:간격" 형식의 탐색 범위 파싱 (간격 생략 시 1)
+bool parseRange(const std::string& spec, ParameterRange& range) {
+    size_t eq = spec.find('=');
+    if (eq == std::string::npos || eq == 0) return false;
 
-        for (int i = 0; i < totalCandles; ++i) {
-            OHLCV candle;
-            candle.code = code;
-            candle.timestamp = baseTime + (i * 60000LL);
+    range.name = spec.substr(0, eq);
+    std::string values = spec.substr(eq + 1);
 
-            // 가격 변동 시뮬레이션
-            double dailyTrend = sin(i / (double)candlesPerDay * 0.1) * 0.02;
-            double noise = ((rand() % 200) - 100) / 10000.0;
-            double change = dailyTrend + noise;
+    size_t c1 = values.find(':');
+    if (c1 == std::string::npos) return false;
+    size_t c2 = values.find(':', c1 + 1);
 
-            // 갭 발생 시뮬레이션 (장 시작 시)
-            if (i % candlesPerDay == 0 && rand() % 10 < 3) {
-                change += ((rand() % 40) - 10) / 1000.0;
-            }
+    char* end = nullptr;
+    range.minValue = std::strtod(values.c_str(), &end);
+    if (end != values.c_str() + c1) return false;
 
-            candle.open = basePrice;
-            basePrice *= (1.0 + change);
-            candle.close = basePrice;
-            candle.high = (std::max)(candle.open, candle.close) * (1.0 + (rand() % 30) / 10000.0);
-            candle.low = (std::min)(candle.open, candle.close) * (1.0 - (rand() % 30) / 10000.0);
-            candle.volume = 10000 + rand() % 90000;
+    std::string maxText = values.substr(c1 + 1, c2 == std::string::npos ? std::string::npos : c2 - c1 - 1);
+    range.maxValue = std::strtod(maxText.c_str(), &end);
+    if (maxText.empty() || *end != '\0') return false;
 
-            // 거래량 스파이크
-            if (rand() % 20 == 0) {
-                candle.volume *= 3;
-            }
+    range.step = 1.0;
+    if (c2 != std::string::npos) {
+        std::string stepText = values.substr(c2 + 1);
+        range.step = std::strtod(stepText.c_str(), &end);
+        if (stepText.empty() || *end != '\0') return false;
+    }
+    return range.maxValue >= range.minValue;
+}
 
-            candles.push_back(candle);
-        }
+void printUsage() {
+    std::cout << "Usage:\n"
+              << "  backtest [--windowed-indicators] [--close-fills] [--fill-path pessimistic|optimistic|direction]\n"
+              << "  backtest --optimize <strategy> <name=min:max[:step]>... [--random N] [--seed S]\n"
+              << "           [--rank sharpe|pf|drawdown] [--min-trades N] [--out path]\n"
+              << "  backtest --walkforward <strategy> <name=min:max[:step]>... [--is DAYS] [--oos DAYS]\n"
+              << "           [--step DAYS] [optimize options]\n"
+              << "  backtest --replay [--strategy NAME]... [--ticks file.csv] [--ticks-per-bar N]\n"
+              << "  backtest --montecarlo <strategy> [name=value]... [--resamples N]\n"
+              << "           [--method bootstrap|block|shuffle] [--block N] [--seed S]\n"
+              << "           [--confidence C] [--ruin DRAWDOWN%] [--out path]\n"
+              << "\n  --windowed-indicators  recompute indicators from the lookback window on every bar\n"
+              << "                         (default: precompute each strategy's indicators once per symbol)\n"
+              << "  --close-fills          check stops/targets on the bar close with a flat 0.1% slippage\n"
+              << "                         (default: intrabar high/low fills, volume-based slippage, KRX ticks)\n"
+              << "  --fill-path            which of stop/target fills first when one bar touches both\n"
+              << "\nExample:\n"
+              << "  backtest --optimize BBSqueeze bbPeriod=10:30:5 squeezePercentile=0.1:0.3:0.05\n"
+              << "  backtest --walkforward MABreakout fastMA=3:7:2 --is 60 --oos 20\n"
+              << "  backtest --replay --strategy BBSqueeze --ticks-per-bar 8\n"
+              << "  backtest --montecarlo MABreakout --resamples 100000 --method block --block 5\n"
+              << std::endl;
+}
 
-        historicalData[code] = candles;
-        std::cout << "Generated " << candles.size() << " simulated candles for " << code << std::endl;
+// 최적화/워크포워드 옵션 파싱 (walkForward가 nullptr이면 구간 옵션은 허용하지 않음)
+bool parseOptimizerArgs(int argc, char* argv[], OptimizerConfig& config,
+                        std::string& outputPath, WalkForwardConfig* walkForward) {
+    if (argc < 4) {
+        printUsage();
+        return false;
     }
 
-    // 백테스트 실행
-    BacktestResult run(const std::string& strategyName) {
-        BacktestResult result;
-
-        if (historicalData.empty()) {
-            std::cerr << "No data loaded" << std::endl;
-            return result;
-        }
+    config.strategyName = argv[2];
+    if (!Backtester::createStrategy(config.strategyName)) {
+        std::cerr << "Unknown strategy: " << config.strategyName << std::endl;
+        return false;
+    }
 
-        // 전략 초기화
-        std::unique_ptr<Strategy> strategy;
-        if (strategyName == "GapPullback") {
-            strategy = std::make_unique<GapPullbackStrategy>();
-        } else if (strategyName == "MABreakout") {
-            strategy = std::make_unique<MABreakoutStrategy>();
-        } else if (strategyName == "BBSqueeze") {
-            strategy = std::make_unique<BBSqueezeStrategy>();
+    for (int i = 3; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (arg == "--random" && hasValue) {
+            config.mode = OptimizerConfig::Mode::RANDOM;
+            config.randomSamples = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--seed" && hasValue) {
+            config.seed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--min-trades" && hasValue) {
+            config.minTrades = std::atoi(argv[++i]);
+        } else if (arg == "--out" && hasValue) {
+            outputPath = argv[++i];
+        } else if (arg == "--rank" && hasValue) {
+            std::string rank = argv[++i];
+            if (rank == "sharpe") config.rankBy = OptimizerConfig::RankBy::SHARPE;
+            else if (rank == "pf") config.rankBy = OptimizerConfig::RankBy::PROFIT_FACTOR;
+            else if (rank == "drawdown") config.rankBy = OptimizerConfig::RankBy::DRAWDOWN;
+            else {
+                std::cerr << "Unknown rank metric: " << rank << std::endl;
+                return false;
+            }
+        } else if (walkForward && arg == "--is" && hasValue) {
+            walkForward->inSampleDays = std::strtoul(argv[++i], nullptr, 10);
+        } else if (walkForward && arg == "--oos" && hasValue) {
+            walkForward->outOfSampleDays = std::strtoul(argv[++i], nullptr, 10);
+        } else if (walkForward && arg == "--step" && hasValue) {
+            walkForward->stepDays = std::strtoul(argv[++i], nullptr, 10);
         } else {
-            std::cerr << "Unknown strategy: " << strategyName << std::endl;
-            return result;
-        }
-
-        // 리스크 매니저 초기화
-        RiskManager rm(config);
-
-        // 각 종목별 백테스트
-        for (auto& [code, candles] : historicalData) {
-            std::cout << "\nBacktesting " << strategyName << " on " << code << "..." << std::endl;
-
-            // 시뮬레이션
-            simulateTrading(strategy.get(), rm, code, candles);
+            ParameterRange range;
+            if (!parseRange(arg, range)) {
+                std::cerr << "Invalid parameter range: " << arg << std::endl;
+                printUsage();
+                return false;
+            }
+            config.ranges.push_back(range);
         }
-
-        // 결과 계산
-        calculateResults(result);
-
-        return result;
     }
 
-    // 거래 기록 조회
-    const std::vector<BacktestTrade>& getTrades() const {
-        return trades;
+    if (config.ranges.empty()) {
+        printUsage();
+        return false;
     }
+    return true;
+}
 
-    // 일별 자산 곡선 조회
-    const std::vector<std::pair<long long, double>>& getEquityCurve() const {
-        return equityCurve;
+// 최적화 모드
+int runOptimizer(const Backtester& backtester, int argc, char* argv[]) {
+    OptimizerConfig config;
+    std::string outputPath = std::string("logs/optimize_") + (argc > 2 ? argv[2] : "") + ".csv";
+    if (!parseOptimizerArgs(argc, argv, config, outputPath, nullptr)) {
+        return 1;
     }
 
-private:
-    DailyBudgetConfig config;
-    double slippage;
-    double commission;
-    double tax;
-
-    std::map<std::string, std::vector<OHLCV>> historicalData;
-    std::vector<BacktestTrade> trades;
-    std::vector<std::pair<long long, double>> equityCurve;
-
-    // 현재 포지션
-    struct SimPosition {
-        std::string code;
-        int quantity;
-        double entryPrice;
-        long long entryTime;
-        double stopLoss;
-        double takeProfit1;
-        double takeProfit2;
-        std::string strategy;
-    };
-    std::map<std::string, SimPosition> positions;
-    double cash = 10000000.0;
-    double peakEquity = 10000000.0;
-    double maxDrawdown = 0.0;
-
-    void simulateTrading(Strategy* strategy, RiskManager& rm,
-                         const std::string& code,
-                         const std::vector<OHLCV>& candles) {
-        int lookback = 100;  // 지표 계산용 lookback
-
-        for (size_t i = lookback; i < candles.size(); ++i) {
-            // 시세 데이터 생성
-            QuoteData quote;
-            quote.code = code;
-            quote.currentPrice = candles[i].close;
-            quote.openPrice = candles[i].open;
-            quote.highPrice = candles[i].high;
-            quote.lowPrice = candles[i].low;
-            quote.volume = candles[i].volume;
-            quote.timestamp = candles[i].timestamp;
-
-            // 전일 종가 (전날 마지막 봉)
-            int candlesPerDay = 390;
-            if (i >= candlesPerDay) {
-                quote.prevClose = candles[i - candlesPerDay].close;
-            } else {
-                quote.prevClose = candles[0].open;
-            }
-            quote.changeRate = ((quote.currentPrice - quote.prevClose) / quote.prevClose) * 100.0;
-
-            // lookback 데이터
-            std::vector<OHLCV> lookbackCandles(candles.begin() + i - lookback,
-                                                candles.begin() + i + 1);
-
-            // 포지션 확인 및 청산 조건 체크
-            auto posIt = positions.find(code);
-            if (posIt != positions.end()) {
-                SimPosition& pos = posIt->second;
-
-                // 손절 체크
-                if (quote.currentPrice <= pos.stopLoss) {
-                    closeTrade(pos, quote.currentPrice, candles[i].timestamp, "StopLoss");
-                    positions.erase(posIt);
-                    continue;
-                }
-
-                // 익절 체크
-                if (quote.currentPrice >= pos.takeProfit1) {
-                    closeTrade(pos, quote.currentPrice, candles[i].timestamp, "TakeProfit");
-                    positions.erase(posIt);
-                    continue;
-                }
-
-                // 시간 기반 청산 (장 마감 1시간 전)
-                int candleInDay = i % 390;
-                if (candleInDay >= 330) {  // 14:30
-                    closeTrade(pos, quote.currentPrice, candles[i].timestamp, "TimeStop");
-                    positions.erase(posIt);
-                    continue;
-                }
-            }
-
-            // 새 진입 신호 분석
-            if (positions.find(code) == positions.end()) {
-                // 장 시작 시간 체크 (갭 전략용)
-                int candleInDay = i % 390;
-                if (candleInDay < 15 || candleInDay > 300) {
-                    continue;  // 장 시작 15분 또는 장 마감 90분 전에는 진입 안함
-                }
-
-                SignalInfo signal = strategy->analyze(code, lookbackCandles, quote);
-
-                if (signal.signal == Signal::BUY) {
-                    // 포지션 크기 계산
-                    double maxPosition = cash * config.maxPositionRatio;
-                    int qty = static_cast<int>(maxPosition / quote.currentPrice);
-
-                    if (qty > 0 && positions.size() < static_cast<size_t>(config.maxConcurrentPositions)) {
-                        double fillPrice = quote.currentPrice * (1.0 + slippage);
-                        double cost = fillPrice * qty * (1.0 + commission);
-
-                        if (cost <= cash) {
-                            SimPosition pos;
-                            pos.code = code;
-                            pos.quantity = qty;
-                            pos.entryPrice = fillPrice;
-                            pos.entryTime = candles[i].timestamp;
-                            pos.stopLoss = signal.stopLoss > 0 ? signal.stopLoss :
-                                           fillPrice * (1.0 - 0.01);
-                            pos.takeProfit1 = signal.takeProfit1 > 0 ? signal.takeProfit1 :
-                                              fillPrice * (1.0 + 0.02);
-                            pos.strategy = strategy->getName();
-
-                            positions[code] = pos;
-                            cash -= cost;
-                        }
-                    }
-                }
-            }
+    ThreadPool pool;
+    StrategyOptimizer optimizer(backtester, pool);
 
-            // 자산 곡선 업데이트
-            double equity = cash;
-            for (const auto& [c, pos] : positions) {
-                equity += pos.quantity * quote.currentPrice;
-            }
+    auto startTime = std::chrono::steady_clock::now();
+    std::vector<OptimizationResult> results = optimizer.optimize(config);
+    auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - startTime).count();
 
-            // 일별로 기록 (장 마감 시)
-            if (i % 390 == 389) {
-                equityCurve.push_back({candles[i].timestamp, equity});
+    if (results.empty()) {
+        return 1;
+    }
 
-                // 최대 낙폭 계산
-                peakEquity = (std::max)(peakEquity, equity);
-                double drawdown = (peakEquity - equity) / peakEquity;
-                maxDrawdown = (std::max)(maxDrawdown, drawdown);
-            }
-        }
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "  Optimization Results: " << config.strategyName << std::endl;
+    std::cout << "========================================\n" << std::endl;
 
-        // 남은 포지션 청산
-        for (auto& [c, pos] : positions) {
-            if (c == code && !historicalData[code].empty()) {
-                double lastPrice = historicalData[code].back().close;
-                long long lastTime = historicalData[code].back().timestamp;
-                closeTrade(pos, lastPrice, lastTime, "EndOfTest");
-            }
+    size_t shown = (std::min)(results.size(), size_t(10));
+    for (size_t i = 0; i < shown; ++i) {
+        const OptimizationResult& r = results[i];
+        std::cout << std::setw(3) << (i + 1) << ".";
+        for (const auto& [name, value] : r.parameters) {
+            std::cout << " " << name << "=" << value;
         }
-        positions.erase(code);
+        std::cout << std::fixed << std::setprecision(2)
+                  << " | Sharpe " << r.result.sharpeRatio
+                  << ", PF " << r.result.profitFactor
+                  << ", MDD " << r.result.maxDrawdown << "%"
+                  << ", Return " << r.result.totalReturn << "%"
+                  << ", Trades " << r.result.totalTrades << std::endl;
+        std::cout.unsetf(std::ios::fixed);
     }
 
-    void closeTrade(const SimPosition& pos, double exitPrice, long long exitTime,
-                    const std::string& reason) {
-        double fillPrice = exitPrice * (1.0 - slippage);
-        double proceeds = pos.quantity * fillPrice;
-        double sellCommission = proceeds * commission;
-        double sellTax = proceeds * tax;
-
-        proceeds -= (sellCommission + sellTax);
-        cash += proceeds;
-
-        double pnl = proceeds - (pos.entryPrice * pos.quantity);
-        double pnlPercent = (fillPrice - pos.entryPrice) / pos.entryPrice * 100.0;
-
-        BacktestTrade trade;
-        trade.code = pos.code;
-        trade.entryTime = pos.entryTime;
-        trade.exitTime = exitTime;
-        trade.entryPrice = pos.entryPrice;
-        trade.exitPrice = fillPrice;
-        trade.quantity = pos.quantity;
-        trade.pnl = pnl;
-        trade.pnlPercent = pnlPercent;
-        trade.strategy = pos.strategy;
-        trade.exitReason = reason;
-
-        trades.push_back(trade);
-    }
+    std::cout << "\nEvaluated " << results.size() << " combinations in " << elapsedMs
+              << "ms" << std::endl;
 
-    void calculateResults(BacktestResult& result) {
-        if (trades.empty()) {
-            return;
-        }
+    StrategyOptimizer::writeResults(outputPath, results);
+    return 0;
+}
 
-        // 기본 통계
-        result.totalTrades = trades.size();
-        double totalPnL = 0.0;
-        double totalWin = 0.0;
-        double totalLoss = 0.0;
-        double totalHoldingTime = 0.0;
-
-        for (const auto& trade : trades) {
-            totalPnL += trade.pnl;
-
-            if (trade.pnl > 0) {
-                result.winTrades++;
-                totalWin += trade.pnl;
-            } else {
-                result.lossTrades++;
-                totalLoss += std::abs(trade.pnl);
-            }
+// 워크포워드 모드
+int runWalkForward(const Backtester& backtester, int argc, char* argv[]) {
+    WalkForwardConfig config;
+    std::string outputPath = std::string("logs/walkforward_") + (argc > 2 ? argv[2] : "") + ".csv";
+    if (!parseOptimizerArgs(argc, argv, config.optimizer, outputPath, &config)) {
+        return 1;
+    }
 
-            totalHoldingTime += (trade.exitTime - trade.entryTime) / 60000.0;  // 분 단위
-        }
+    ThreadPool pool;
+    StrategyOptimizer optimizer(backtester, pool);
 
-        // 수익률
-        result.totalReturn = totalPnL / config.dailyBudget * 100.0;
+    auto startTime = std::chrono::steady_clock::now();
+    WalkForwardResult result = optimizer.walkForward(config);
+    auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - startTime).count();
 
-        // 승률
-        result.winRate = result.totalTrades > 0 ?
-            (double)result.winTrades / result.totalTrades * 100.0 : 0.0;
+    if (result.windows.empty()) {
+        return 1;
+    }
 
-        // 평균 손익
-        result.avgWin = result.winTrades > 0 ? totalWin / result.winTrades : 0.0;
-        result.avgLoss = result.lossTrades > 0 ? totalLoss / result.lossTrades : 0.0;
+    std::cout << "\nWindows (in-sample " << config.inSampleDays << " days, out-of-sample "
+              << config.outOfSampleDays << " days):" << std::endl;
+    for (size_t i = 0; i < result.windows.size(); ++i) {
+        const WalkForwardWindow& w = result.windows[i];
+        std::cout << std::setw(3) << (i + 1) << ". day " << w.outOfSampleStart << "-"
+                  << (w.outOfSampleStart + w.outOfSampleDays - 1) << ":";
+        for (const auto& [name, value] : w.parameters) {
+            std::cout << " " << name << "=" << value;
+        }
+        std::cout << std::fixed << std::setprecision(2)
+                  << " | IS Sharpe " << w.inSample.sharpeRatio
+                  << ", OOS Sharpe " << w.outOfSample.sharpeRatio
+                  << ", OOS Return " << w.outOfSample.totalReturn << "%"
+                  << ", Trades " << w.outOfSample.totalTrades << std::endl;
+        std::cout.unsetf(std::ios::fixed);
+    }
 
-        // 손익비
-        result.profitFactor = result.avgLoss > 0 ? result.avgWin / result.avgLoss : 0.0;
+    printResults(result.aggregate, config.optimizer.strategyName + " (walk-forward, out-of-sample)");
 
-        // 평균 보유 시간
-        result.avgHoldingPeriod = result.totalTrades > 0 ?
-            totalHoldingTime / result.totalTrades : 0.0;
+    std::cout << "Walk-forward completed in " << elapsedMs << "ms" << std::endl;
+    StrategyOptimizer::writeWalkForward(outputPath, result);
+    return 0;
+}
 
-        // 최대 낙폭
-        result.maxDrawdown = maxDrawdown * 100.0;
+// 틱 리플레이 모드 (틱 파일이 없으면 로드된 분봉에서 틱 합성)
+int runReplay(const Backtester& backtester, int argc, char* argv[]) {
+    ReplayConfig config;
+    config.fillModel = backtester.getFillModel();
+    std::string tickPath;
+
+    for (int i = 2; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (arg == "--strategy" && hasValue) {
+            config.strategies.push_back(argv[++i]);
+        } else if (arg == "--ticks" && hasValue) {
+            tickPath = argv[++i];
+        } else if (arg == "--ticks-per-bar" && hasValue) {
+            config.ticksPerBar = std::atoi(argv[++i]);
+        } else {
+            printUsage();
+            return 1;
+        }
+    }
 
-        // 연환산 수익률 (가정: 250 거래일)
-        if (!equityCurve.empty()) {
-            int tradingDays = equityCurve.size();
-            result.annualizedReturn = result.totalReturn * (250.0 / tradingDays);
+    TickReplayer replayer(config);
+    ReplayResult replay;
+    if (!tickPath.empty()) {
+        std::vector<std::string> codes;
+        std::vector<ReplayTick> ticks;
+        if (!TickReplayer::loadTicks(tickPath, codes, ticks)) {
+            return 1;
         }
+        replay = replayer.replayTicks(codes, ticks);
+    } else {
+        replay = replayer.replayBars(backtester.getHistory());
+    }
 
-        // 샤프 비율 (단순화)
-        if (!equityCurve.empty() && equityCurve.size() > 1) {
-            std::vector<double> dailyReturns;
-            for (size_t i = 1; i < equityCurve.size(); ++i) {
-                double ret = (equityCurve[i].second - equityCurve[i-1].second) /
-                             equityCurve[i-1].second;
-                dailyReturns.push_back(ret);
-            }
+    printResults(replay.result, "Tick replay");
 
-            double avgReturn = 0.0;
-            for (double r : dailyReturns) avgReturn += r;
-            avgReturn /= dailyReturns.size();
+    double seconds = replay.elapsedMs / 1000.0;
+    std::cout << "Replayed " << replay.ticks << " ticks (" << replay.candles << " candles, "
+              << replay.evaluations << " evaluations) in " << std::fixed << std::setprecision(0)
+              << replay.elapsedMs << "ms";
+    if (seconds > 0) {
+        std::cout << " (" << (replay.ticks / seconds) << " ticks/s)";
+    }
+    std::cout << std::endl;
+    return 0;
+}
 
-            double variance = 0.0;
-            for (double r : dailyReturns) {
-                variance += (r - avgReturn) * (r - avgReturn);
-            }
-            variance /= dailyReturns.size();
-            double stdDev = std::sqrt(variance);
+// 몬테카를로 모드: 전략을 한 번 백테스트한 뒤 거래 순서를 재표본해 신뢰구간 산출
+int runMonteCarlo(const Backtester& backtester, int argc, char* argv[]) {
+    if (argc < 3) {
+        printUsage();
+        return 1;
+    }
 
-            result.sharpeRatio = stdDev > 0 ?
-                (avgReturn * std::sqrt(250.0)) / (stdDev * std::sqrt(250.0)) : 0.0;
+    BacktestJob job;
+    job.strategyName = argv[2];
+    MonteCarloConfig config;
+    std::string outputPath = "logs/montecarlo_" + job.strategyName + ".csv";
+
+    for (int i = 3; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (arg == "--resamples" && hasValue) {
+            config.resamples = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--method" && hasValue) {
+            std::string method = argv[++i];
+            if (method == "bootstrap") config.method = MonteCarloConfig::Method::BOOTSTRAP;
+            else if (method == "block") config.method = MonteCarloConfig::Method::BLOCK_BOOTSTRAP;
+            else if (method == "shuffle") config.method = MonteCarloConfig::Method::SHUFFLE;
+            else {
+                std::cerr << "Unknown method: " << method << std::endl;
+                return 1;
+            }
+        } else if (arg == "--block" && hasValue) {
+            config.blockSize = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--seed" && hasValue) {
+            config.seed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--confidence" && hasValue) {
+            config.confidence = std::strtod(argv[++i], nullptr);
+        } else if (arg == "--ruin" && hasValue) {
+            config.ruinDrawdown = std::strtod(argv[++i], nullptr);
+        } else if (arg == "--out" && hasValue) {
+            outputPath = argv[++i];
+        } else if (arg.find('=') != std::string::npos && arg.find('=') > 0) {
+            // 전략 파라미터 고정값
+            size_t eq = arg.find('=');
+            job.parameters[arg.substr(0, eq)] = std::strtod(arg.c_str() + eq + 1, nullptr);
+        } else {
+            printUsage();
+            return 1;
         }
     }
-};
 
-void printResults(const BacktestResult& result, const std::string& strategyName) {
-    std::cout << "\n========================================" << std::endl;
-    std::cout << "  Backtest Results: " << strategyName << std::endl;
-    std::cout << "========================================\n" << std::endl;
+    ThreadPool pool;
+    std::vector<BacktestJobResult> results = backtester.runParallel({job}, pool);
+    const BacktestJobResult& base = results.front();
+    std::cout << base.log;
+    printResults(base.result, job.strategyName);
 
-    std::cout << std::fixed << std::setprecision(2);
+    MonteCarloSimulator simulator(pool);
+    MonteCarloResult mc = simulator.run(base.trades, config);
+    if (mc.resamples == 0) {
+        return 1;
+    }
 
-    std::cout << "Performance Metrics:" << std::endl;
-    std::cout << "  Total Return:       " << result.totalReturn << "%" << std::endl;
-    std::cout << "  Annualized Return:  " << result.annualizedReturn << "%" << std::endl;
-    std::cout << "  Max Drawdown:       " << result.maxDrawdown << "%" << std::endl;
-    std::cout << "  Sharpe Ratio:       " << result.sharpeRatio << std::endl;
-    std::cout << std::endl;
+    auto printRow = [](const char* label, const MonteCarloDistribution& d) {
+        std::cout << "  " << label << std::setw(9) << d.mean << std::setw(9) << d.stdDev
+                  << std::setw(9) << d.lower << std::setw(9) << d.median
+                  << std::setw(9) << d.upper << std::setw(9) << d.min
+                  << std::setw(9) << d.max << std::endl;
+    };
 
-    std::cout << "Trade Statistics:" << std::endl;
-    std::cout << "  Total Trades:       " << result.totalTrades << std::endl;
-    std::cout << "  Winning Trades:     " << result.winTrades << std::endl;
-    std::cout << "  Losing Trades:      " << result.lossTrades << std::endl;
-    std::cout << "  Win Rate:           " << result.winRate << "%" << std::endl;
-    std::cout << "  Profit Factor:      " << result.profitFactor << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Monte Carlo (" << mc.resamples << " resamples of " << mc.tradesPerPath
+              << " trades, " << (mc.confidence * 100.0) << "% interval):" << std::endl;
+    std::cout << std::string(19, ' ');
+    for (const char* column : {"Mean", "Std", "Lower", "Median", "Upper", "Min", "Max"}) {
+        std::cout << std::setw(9) << column;
+    }
     std::cout << std::endl;
-
-    std::cout << "Average Trade:" << std::endl;
-    std::cout << "  Avg Win:            " << std::setprecision(0) << result.avgWin << " KRW" << std::endl;
-    std::cout << "  Avg Loss:           " << result.avgLoss << " KRW" << std::endl;
-    std::cout << "  Avg Holding Time:   " << std::setprecision(1) << result.avgHoldingPeriod << " min" << std::endl;
-
-    std::cout << "\n========================================\n" << std::endl;
+    printRow("Total Return %:  ", mc.totalReturn);
+    printRow("Max Drawdown %:  ", mc.maxDrawdown);
+    std::cout << "  Risk of Ruin:      " << mc.riskOfRuin << "% (drawdown >= "
+              << config.ruinDrawdown << "%)" << std::endl;
+    std::cout << "  Probability of Loss: " << mc.probabilityOfLoss << "%" << std::endl;
+    std::cout << std::setprecision(0) << "\nResampled in " << mc.elapsedMs << "ms on "
+              << pool.size() << " threads" << std::endl;
+    std::cout.unsetf(std::ios::fixed);
+
+    MonteCarloSimulator::writePaths(outputPath, mc);
+    return 0;
 }
 
 int main(int argc, char* argv[]) {
+    // 공통 옵션은 먼저 걸러내고 나머지 인자로 모드를 결정
+    bool windowedIndicators = false;
+    bool closeFills = false;
+    FillModelConfig fillConfig;
+    std::vector<char*> args;
+    for (int i = 0; i < argc; ++i) {
+        std::string arg = i > 0 ? argv[i] : "";
+        if (arg == "--windowed-indicators") {
+            windowedIndicators = true;
+        } else if (arg == "--close-fills") {
+            closeFills = true;
+        } else if (arg == "--fill-path" && i + 1 < argc) {
+            std::string path = argv[++i];
+            if (path == "pessimistic") fillConfig.path = IntrabarPath::PESSIMISTIC;
+            else if (path == "optimistic") fillConfig.path = IntrabarPath::OPTIMISTIC;
+            else if (path == "direction") fillConfig.path = IntrabarPath::BAR_DIRECTION;
+            else {
+                std::cerr << "Unknown fill path: " << path << std::endl;
+                return 1;
+            }
+        } else {
+            args.push_back(argv[i]);
+        }
+    }
+    argc = static_cast<int>(args.size());
+    argv = args.data();
+
     std::cout << "========================================" << std::endl;
     std::cout << "  Yuanta Backtesting System v1.0" << std::endl;
     std::cout << "========================================\n" << std::endl;
 
     Backtester backtester;
+    backtester.setPrecomputeIndicators(!windowedIndicators);
+    if (closeFills) {
+        backtester.setFillModel(std::make_shared<CloseFillModel>());
+    } else {
+        backtester.setFillModel(std::make_shared<IntrabarFillModel>(fillConfig));
+    }
 
     // 시뮬레이션 데이터 생성 (실제 사용 시 loadData 사용)
     std::vector<std::string> codes = {"005930", "000660", "035420"};
 
-    for (const auto& code : codes) {
-        // 데이터 파일이 있으면 로드, 없으면 시뮬레이션 데이터 생성
-        std::string filepath = "data/" + code + "_1m.csv";
-        if (!backtester.loadData(filepath, code)) {
-            backtester.generateSimulatedData(code, 180);  // 6개월
+    // 바이너리 봉 파일이 있으면 우선 사용
+    if (!backtester.loadBinary("data/history_1m.ybar")) {
+        for (const auto& code : codes) {
+            // 데이터 파일이 있으면 로드, 없으면 시뮬레이션 데이터 생성
+            std::string filepath = "data/" + code + "_1m.csv";
+            if (!backtester.loadData(filepath, code)) {
+                backtester.generateSimulatedData(code, 180);  // 6개월
+            }
         }
     }
 
-    // 각 전략별 백테스트
+    // 최적화/워크포워드/리플레이/몬테카를로 모드
+    if (argc > 1) {
+        std::string mode = argv[1];
+        if (mode == "--optimize") {
+            return runOptimizer(backtester, argc, argv);
+        }
+        if (mode == "--walkforward") {
+            return runWalkForward(backtester, argc, argv);
+        }
+        if (mode == "--replay") {
+            return runReplay(backtester, argc, argv);
+        }
+        if (mode == "--montecarlo") {
+            return runMonteCarlo(backtester, argc, argv);
+        }
+        printUsage();
+        return 1;
+    }
+
+    // 전략별 작업을 스레드 풀에서 병렬 실행 (이력 데이터는 공유, 작업별 상태는 독립)
     std::vector<std::string> strategies = {"GapPullback", "MABreakout", "BBSqueeze"};
 
+    std::vector<BacktestJob> jobs;
     for (const auto& strategyName : strategies) {
-        // 새 백테스터로 각 전략 테스트
-        Backtester bt;
-        for (const auto& code : codes) {
-            bt.generateSimulatedData(code, 180);
-        }
+        BacktestJob job;
+        job.strategyName = strategyName;    // 로드된 전 종목, 기본 파라미터
+        jobs.push_back(job);
+    }
+
+    ThreadPool pool;
+    auto startTime = std::chrono::steady_clock::now();
+    std::vector<BacktestJobResult> results = backtester.runParallel(jobs, pool);
+    auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - startTime).count();
 
-        BacktestResult result = bt.run(strategyName);
-        printResults(result, strategyName);
+    // 결과는 작업 순서대로 출력
+    for (const auto& jobResult : results) {
+        const std::string& strategyName = jobResult.job.strategyName;
+
+        std::cout << jobResult.log;
+        printResults(jobResult.result, strategyName);
 
         // 거래 기록 저장
         std::string outputPath = "logs/backtest_" + strategyName + ".csv";
         std::ofstream outFile(outputPath);
         if (outFile.is_open()) {
             outFile << "Code,EntryTime,ExitTime,EntryPrice,ExitPrice,Quantity,PnL,PnL%,Strategy,ExitReason\n";
-            for (const auto& trade : bt.getTrades()) {
+            for (const auto& trade : jobResult.trades) {
                 outFile << trade.code << ","
                         << trade.entryTime << ","
                         << trade.exitTime << ","
@@ -540,6 +500,9 @@ int main(int argc, char* argv[]) {
         }
     }
 
+    std::cerr << "Ran " << jobs.size() << " backtest jobs on " << pool.size()
+              << " threads in " << elapsedMs << "ms" << std::endl;
+
     std::cout << "\nBacktesting completed!" << std::endl;
 
     return 0;
@@ -0,0 +1,582 @@
+#include "../../include/Backtester.h"
+#include "../../include/CSVBarParser.h"
+#include "../../include/BarFile.h"
+#include "../../include/ThreadPool.h"
+#include "../../include/BarStream.h"
+#include "../../include/Clock.h"
+
+#include <iostream>
+#include <sstream>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include <future>
+
+namespace yuanta {
+
+Backtester::Backtester()
+    : history(std::make_shared<BarHistory>()),
+      log(&std::cout) {
+    // 기본 설정
+    config.dailyBudget = 10000000.0;
+    config.maxPositionRatio = 0.20;
+    config.maxDailyLossRatio = 0.03;
+    config.maxConcurrentPositions = 3;
+
+    // 거래 비용 설정 (슬리피지는 체결 모델이 담당)
+    fillModel = std::make_shared<IntrabarFillModel>();
+    commission = 0.00015;  // 0.015%
+    tax = 0.0023;          // 0.23%
+}
+
+bool Backtester::loadData(const std::string& filepath, const std::string& code) {
+    std::vector<OHLCV> candles;
+    if (!CSVBarParser::parseFile(filepath, candles)) {
+        std::cerr << "Failed to open: " << filepath << std::endl;
+        return false;
+    }
+
+    std::cout << "Loaded " << candles.size() << " candles for " << code << std::endl;
+    (*history)[code] = std::move(candles);
+    return true;
+}
+
+bool Backtester::loadBinary(const std::string& filepath) {
+    BarFileReader reader;
+    if (!reader.open(filepath)) {
+        return false;
+    }
+
+    BarSeriesView view;
+    for (size_t i = 0; i < reader.symbolCount(); ++i) {
+        if (!reader.series(i, view)) continue;
+
+        std::vector<OHLCV>& candles = (*history)[view.code];
+        candles.clear();
+        view.appendTo(candles);
+        std::cout << "Loaded " << candles.size() << " candles for " << view.code << std::endl;
+    }
+    return reader.symbolCount() > 0;
+}
+
+void Backtester::generateSimulatedData(const std::string& code, int days) {
+    std::vector<OHLCV> candles;
+
+    // 분봉 데이터 생성 (하루 390분)
+    int candlesPerDay = 390;
+    int totalCandles = days * candlesPerDay;
+
+    double basePrice = 50000.0;
+    long long baseTime = 1704067200000LL;  // 2024-01-01 09:00 (KST)
+
+    srand(42);  // 재현 가능한 결과
+
+    for (int i = 0; i < totalCandles; ++i) {
+        OHLCV candle;
+        // 거래일마다 09:00(KST)부터 1분 간격 (DayIndex가 하루 단위로 나눌 수 있도록)
+        candle.timestamp = baseTime + (i / candlesPerDay) * DayIndex::DAY_MS +
+                           (i % candlesPerDay) * 60000LL;
+
+        // 가격 변동 시뮬레이션
+        double dailyTrend = sin(i / (double)candlesPerDay * 0.1) * 0.02;
+        double noise = ((rand() % 200) - 100) / 10000.0;
+        double change = dailyTrend + noise;
+
+        // 갭 발생 시뮬레이션 (장 시작 시)
+        if (i % candlesPerDay == 0 && rand() % 10 < 3) {
+            change += ((rand() % 40) - 10) / 1000.0;
+        }
+
+        candle.open = basePrice;
+        basePrice *= (1.0 + change);
+        candle.close = basePrice;
+        candle.high = (std::max)(candle.open, candle.close) * (1.0 + (rand() % 30) / 10000.0);
+        candle.low = (std::min)(candle.open, candle.close) * (1.0 - (rand() % 30) / 10000.0);
+        candle.volume = 10000 + rand() % 90000;
+
+        // 거래량 스파이크
+        if (rand() % 20 == 0) {
+            candle.volume *= 3;
+        }
+
+        candles.push_back(candle);
+    }
+
+    std::cout << "Generated " << candles.size() << " simulated candles for " << code << std::endl;
+    (*history)[code] = std::move(candles);
+}
+
+void Backtester::shareHistory(const Backtester& source) {
+    history = source.history;
+}
+
+std::unique_ptr<Strategy> Backtester::createStrategy(const std::string& strategyName) {
+    if (strategyName == "GapPullback") {
+        return std::make_unique<GapPullbackStrategy>();
+    } else if (strategyName == "MABreakout") {
+        return std::make_unique<MABreakoutStrategy>();
+    } else if (strategyName == "BBSqueeze") {
+        return std::make_unique<BBSqueezeStrategy>();
+    }
+    return nullptr;
+}
+
+BacktestResult Backtester::run(const std::string& strategyName,
+                               const std::vector<std::string>& codes,
+                               const std::map<std::string, double>& parameters) {
+    BacktestJob job;
+    job.strategyName = strategyName;
+    job.codes = codes;
+    job.parameters = parameters;
+    return run(job);
+}
+
+BacktestResult Backtester::run(const BacktestJob& job) {
+    BacktestResult result;
+
+    if (history->empty()) {
+        std::cerr << "No data loaded" << std::endl;
+        return result;
+    }
+
+    // 전략 초기화
+    std::unique_ptr<Strategy> strategy = createStrategy(job.strategyName);
+    if (!strategy) {
+        std::cerr << "Unknown strategy: " << job.strategyName << std::endl;
+        return result;
+    }
+    for (const auto& [name, value] : job.parameters) {
+        // setParameter는 모르는 이름을 무시하므로 오타가 기본값 실행으로 묻히지 않게 거부
+        if (!strategy->hasParameter(name)) {
+            std::cerr << "Unknown parameter for " << job.strategyName << ": " << name << std::endl;
+            return result;
+        }
+        strategy->setParameter(name, value);
+    }
+
+    // 리스크 매니저 초기화
+    RiskManager rm(config);
+
+    // 대상 종목별 구간 준비 (종목코드 순, 같은 시각의 봉은 이 순서로 처리)
+    std::vector<SimSymbol> symbols;
+    for (const auto& [code, candles] : *history) {
+        if (!job.codes.empty() &&
+            std::find(job.codes.begin(), job.codes.end(), code) == job.codes.end()) {
+            continue;
+        }
+
+        // 구간 잘라내기 (봉 시각의 거래일 경계, 앞쪽 워밍업 포함)
+        Span<OHLCV> bars(candles);
+        size_t tradeStart = 0;
+        if (job.firstDay > 0 || job.dayCount > 0) {
+            DayIndex days(bars);
+            if (job.firstDay >= days.dayCount()) continue;
+
+            size_t warmup = (std::min)(job.warmupDays, job.firstDay);
+            size_t first = job.firstDay - warmup;
+            size_t dayCount = job.dayCount > 0 ? warmup + job.dayCount : days.dayCount() - first;
+
+            bars = days.dayRange(first, dayCount);
+            tradeStart = days.day(job.firstDay).begin - days.day(first).begin;
+        }
+
+        *log << "\nBacktesting " << job.strategyName << " on " << code << "..." << std::endl;
+
+        SimSymbol symbol;
+        symbol.code = code;
+        symbol.symbolId = SymbolRegistry::instance().intern(code);
+        symbol.candles = bars;
+        symbol.tradeStart = tradeStart;
+        symbols.push_back(std::move(symbol));
+    }
+
+    // 전 종목을 시각순으로 병합해 한 계좌로 시뮬레이션
+    simulatePortfolio(strategy.get(), rm, symbols);
+
+    // 결과 계산
+    calculateResults(result);
+
+    return result;
+}
+
+size_t Backtester::tradingDays(const std::vector<std::string>& codes) const {
+    size_t days = 0;
+    bool first = true;
+    for (const auto& [code, candles] : *history) {
+        if (!codes.empty() && std::find(codes.begin(), codes.end(), code) == codes.end()) {
+            continue;
+        }
+        size_t count = DayIndex(Span<OHLCV>(candles)).dayCount();
+        days = first ? count : (std::min)(days, count);
+        first = false;
+    }
+    return days;
+}
+
+BacktestResult Backtester::summarize(const std::vector<BacktestTrade>& trades,
+                                     const std::vector<std::pair<long long, double>>& equityCurve) {
+    Backtester bt;
+    bt.trades = trades;
+    bt.equityCurve = equityCurve;
+
+    for (const auto& point : equityCurve) {
+        bt.peakEquity = (std::max)(bt.peakEquity, point.second);
+        bt.maxDrawdown = (std::max)(bt.maxDrawdown,
+                                    (bt.peakEquity - point.second) / bt.peakEquity);
+    }
+
+    BacktestResult result;
+    bt.calculateResults(result);
+    return result;
+}
+
+std::vector<BacktestJobResult> Backtester::runParallel(const std::vector<BacktestJob>& jobs,
+                                                       ThreadPool& pool) const {
+    std::vector<std::future<BacktestJobResult>> futures;
+    futures.reserve(jobs.size());
+
+    for (const auto& job : jobs) {
+        futures.push_back(pool.submit([this, job]() {
+            // 작업 전용 백테스터: 계좌/포지션/전략 상태는 독립, 이력은 공유
+            Backtester bt;
+            bt.config = config;
+            bt.fillModel = fillModel;
+            bt.commission = commission;
+            bt.tax = tax;
+            bt.precomputeIndicators = precomputeIndicators;
+            bt.shareHistory(*this);
+
+            std::ostringstream jobLog;
+            bt.setLog(&jobLog);
+
+            BacktestJobResult out;
+            out.job = job;
+            out.result = bt.run(job);
+            out.trades = std::move(bt.trades);
+            out.equityCurve = std::move(bt.equityCurve);
+            out.log = jobLog.str();
+            return out;
+        }));
+    }
+
+    // 제출 순서대로 수집 (스케줄링과 무관하게 결과 순서 고정)
+    std::vector<BacktestJobResult> results;
+    results.reserve(jobs.size());
+    for (auto& f : futures) {
+        results.push_back(f.get());
+    }
+    return results;
+}
+
+void Backtester::simulatePortfolio(Strategy* strategy, RiskManager& rm,
+                                   std::vector<SimSymbol>& symbols) {
+    // 지표 계산용 lookback (파라미터가 더 긴 구간을 요구하면 늘림, 아니면 신호가 나오지 않음)
+    size_t lookback = (std::max)(size_t(100), strategy->minimumBars());
+    size_t count = symbols.size();
+
+    // 종목별 상태는 병합 스트림의 시리즈 번호로 인덱싱 (봉마다 문자열 조회 없음)
+    std::vector<SimPosition> held(count);
+    std::vector<char> holding(count, 0);
+    std::vector<double> lastPrice(count, 0.0);
+
+    // 리스크 매니저에 등록할 포지션 (일일 손실/동시 보유/투자 한도 판단용)
+    auto riskPosition = [](const SimPosition& pos, double price) {
+        Position p{};
+        p.code = pos.code;
+        p.quantity = pos.quantity;
+        p.remainingQty = pos.quantity;
+        p.avgPrice = pos.entryPrice;
+        p.currentPrice = price;
+        p.stopLossPrice = pos.stopLoss;
+        p.takeProfitPrice1 = pos.takeProfit1;
+        return p;
+    };
+
+    MergedBarStream stream;
+    stream.reserve(count);
+    std::vector<IndicatorKey> required = strategy->requiredIndicators();
+
+    for (SimSymbol& symbol : symbols) {
+        // 종가 컬럼은 종목당 한 번만 추출하고, 매 봉에는 구간 뷰만 넘김 (봉마다 할당 없음)
+        symbol.closes.resize(symbol.candles.size());
+        for (size_t i = 0; i < symbol.candles.size(); ++i) {
+            symbol.closes[i] = symbol.candles[i].close;
+        }
+
+        // 전략이 선언한 지표는 전 구간을 한 번에 계산하고, 매 봉에는 해당 위치의 구간 뷰만 읽음
+        if (precomputeIndicators) {
+            symbol.columns = IndicatorColumns(symbol.candles, Span<double>(symbol.closes), required);
+        }
+
+        symbol.days.build(symbol.candles);
+        stream.addSeries(symbol.candles, (std::max)(lookback, symbol.tradeStart));
+    }
+
+    // 모든 종목의 봉을 시각순으로 처리 (진입/청산/동시 보유 한도/현금이 실제 시간 순서로 적용됨)
+    // 장중 위치와 일 마감은 종목별 거래일 인덱스로 판단 (하루 봉 수가 달라도 됨)
+    // 전략의 장 시간 판단은 봉 시각을 따름 (작업마다 자기 스레드에 모의 시계 설치)
+    SimulatedClock clock;
+    ScopedClock clockScope(clock);
+
+    std::vector<size_t> dayCursor(count, 0);
+    long long currentDay = -1;
+    bool dayClosed = false;
+    MergedBarStream::Event event;
+    while (stream.next(event)) {
+        size_t s = event.series;
+        size_t i = event.index;
+        const SimSymbol& symbol = symbols[s];
+        Span<OHLCV> candles = symbol.candles;
+        const OHLCV& bar = *event.bar;
+        clock.set(bar.timestamp);
+
+        // 이 봉이 속한 거래일 (종목마다 봉이 순서대로 오므로 커서만 전진)
+        size_t& d = dayCursor[s];
+        while (symbol.days.day(d).end <= i) d++;
+        const DayIndex::Day& day = symbol.days.day(d);
+        int candleInDay = static_cast<int>(i - day.begin);
+
+        // 새 거래일이면 일일 손익 초기화 (전날에서 넘어온 보유분은 다시 등록)
+        if (day.date != currentDay) {
+            currentDay = day.date;
+            rm.resetDaily();
+            for (size_t k = 0; k < count; ++k) {
+                if (holding[k]) rm.addPosition(riskPosition(held[k], lastPrice[k]));
+            }
+        }
+
+        // 시세 데이터 생성
+        QuoteData quote;
+        quote.code = symbol.code;
+        quote.currentPrice = bar.close;
+        quote.openPrice = bar.open;
+        quote.highPrice = bar.high;
+        quote.lowPrice = bar.low;
+        quote.volume = bar.volume;
+        quote.timestamp = bar.timestamp;
+
+        // 전일 종가 (전날 같은 위치의 봉)
+        if (d > 0) {
+            const DayIndex::Day& prev = symbol.days.day(d - 1);
+            quote.prevClose = candles[(std::min)(prev.begin + candleInDay, prev.end - 1)].close;
+        } else {
+            quote.prevClose = candles[0].open;
+        }
+        quote.changeRate = ((quote.currentPrice - quote.prevClose) / quote.prevClose) * 100.0;
+        lastPrice[s] = quote.currentPrice;
+
+        // 포지션 확인 및 청산 조건 체크
+        // (청산한 봉에서는 재진입하지 않고, 자산 곡선 기록은 항상 수행)
+        bool exited = false;
+        if (holding[s]) {
+            SimPosition& pos = held[s];
+            const char* exitReason = nullptr;
+            double exitPrice = 0.0;
+
+            // 손절/익절은 체결 모델이 봉 안에서 판단 (고가/저가, 갭, 경로 가정)
+            ExitFill fill = fillModel->checkExit(bar, pos.stopLoss, pos.takeProfit1, pos.quantity);
+            if (fill.kind == ExitFill::Kind::STOP_LOSS) {
+                exitReason = "StopLoss";            // 손절
+                exitPrice = fill.price;
+            } else if (fill.kind == ExitFill::Kind::TAKE_PROFIT) {
+                exitReason = "TakeProfit";          // 익절
+                exitPrice = fill.price;
+            } else if (candleInDay >= 330) {
+                exitReason = "TimeStop";            // 시간 기반 청산 (14:30, 장 마감 1시간 전)
+                exitPrice = fillModel->sellPrice(bar.close, pos.quantity, bar.volume);
+            }
+
+            if (exitReason) {
+                closeTrade(pos, exitPrice, bar.timestamp, exitReason);
+                rm.closePosition(pos.code, exitPrice, pos.quantity);
+                holding[s] = 0;
+                exited = true;
+            } else {
+                // 평가손익 갱신 (일일 손실 한도는 미실현 손실까지 포함)
+                rm.updatePosition(pos.code, bar.close);
+            }
+        }
+
+        // 새 진입 신호 분석
+        // 장 시작 15분 또는 장 마감 90분 전에는 진입 안함 (갭 전략용)
+        bool entryWindow = candleInDay >= 15 && candleInDay <= 300;
+
+        if (!exited && entryWindow && !holding[s]) {
+            // lookback 구간 (현재 봉 포함, 복사 없음)
+            Span<OHLCV> lookbackCandles = candles.subspan(i - lookback, lookback + 1);
+            Span<double> lookbackCloses = Span<double>(symbol.closes).subspan(i - lookback, lookback + 1);
+
+            IndicatorContext ctx(symbol.code, symbol.symbolId, 1, lookbackCandles, lookbackCloses,
+                                 precomputeIndicators ? &symbol.columns : nullptr, i - lookback);
+            SignalInfo signal = strategy->analyze(ctx, quote);
+
+            if (signal.signal == Signal::BUY) {
+                // 포지션 크기: 현금 기준 한도와 리스크 매니저의 종목당/총 투자 한도 중 작은 쪽
+                double maxPosition = cash * config.maxPositionRatio;
+                int qty = (std::min)(static_cast<int>(maxPosition / quote.currentPrice),
+                                     rm.calculateMaxQuantity(symbol.code, quote.currentPrice));
+
+                // 일일 손실 한도, 동시 보유 수, 중복 보유는 실거래와 같은 리스크 매니저가 판단
+                if (qty > 0 && rm.canOpenPosition(symbol.code, quote.currentPrice, qty)) {
+                    double fillPrice = fillModel->buyPrice(quote.currentPrice, qty, bar.volume);
+                    double cost = fillPrice * qty * (1.0 + commission);
+
+                    if (cost <= cash) {
+                        SimPosition& pos = held[s];
+                        pos.code = symbol.code;
+                        pos.quantity = qty;
+                        pos.entryPrice = fillPrice;
+                        pos.entryTime = bar.timestamp;
+                        pos.stopLoss = signal.stopLoss > 0 ? signal.stopLoss :
+                                       fillPrice * (1.0 - 0.01);
+                        pos.takeProfit1 = signal.takeProfit1 > 0 ? signal.takeProfit1 :
+                                          fillPrice * (1.0 + 0.02);
+                        pos.strategy = strategy->getName();
+
+                        holding[s] = 1;
+                        rm.addPosition(riskPosition(pos, quote.currentPrice));
+                        cash -= cost;
+                    }
+                }
+            }
+        }
+
+        // 일별 자산 곡선 (장 마감 봉을 처리한 뒤, 같은 시각의 다른 종목 봉까지 반영하고 한 번 기록)
+        if (i + 1 == day.end) {
+            dayClosed = true;
+        }
+        long long nextTime = 0;
+        if (dayClosed && (!stream.peekTime(nextTime) || nextTime != bar.timestamp)) {
+            double equity = cash;
+            for (size_t k = 0; k < count; ++k) {
+                if (holding[k]) {
+                    equity += held[k].quantity * lastPrice[k];
+                }
+            }
+            equityCurve.push_back({bar.timestamp, equity});
+
+            // 최대 낙폭 계산
+            peakEquity = (std::max)(peakEquity, equity);
+            double drawdown = (peakEquity - equity) / peakEquity;
+            maxDrawdown = (std::max)(maxDrawdown, drawdown);
+            dayClosed = false;
+        }
+    }
+
+    // 남은 포지션 청산 (종목별 마지막 봉)
+    for (size_t s = 0; s < count; ++s) {
+        if (holding[s] && !symbols[s].candles.empty()) {
+            const OHLCV& last = symbols[s].candles.back();
+            closeTrade(held[s], fillModel->sellPrice(last.close, held[s].quantity, last.volume),
+                       last.timestamp, "EndOfTest");
+            holding[s] = 0;
+        }
+    }
+}
+
+void Backtester::closeTrade(const SimPosition& pos, double fillPrice, long long exitTime,
+                            const std::string& reason) {
+    double proceeds = pos.quantity * fillPrice;
+    double sellCommission = proceeds * commission;
+    double sellTax = proceeds * tax;
+
+    proceeds -= (sellCommission + sellTax);
+    cash += proceeds;
+
+    double pnl = proceeds - (pos.entryPrice * pos.quantity);
+    double pnlPercent = (fillPrice - pos.entryPrice) / pos.entryPrice * 100.0;
+
+    BacktestTrade trade;
+    trade.code = pos.code;
+    trade.entryTime = pos.entryTime;
+    trade.exitTime = exitTime;
+    trade.entryPrice = pos.entryPrice;
+    trade.exitPrice = fillPrice;
+    trade.quantity = pos.quantity;
+    trade.pnl = pnl;
+    trade.pnlPercent = pnlPercent;
+    trade.strategy = pos.strategy;
+    trade.exitReason = reason;
+
+    trades.push_back(trade);
+}
+
+void Backtester::calculateResults(BacktestResult& result) {
+    if (trades.empty()) {
+        return;
+    }
+
+    // 기본 통계
+    result.totalTrades = trades.size();
+    double totalPnL = 0.0;
+    double totalWin = 0.0;
+    double totalLoss = 0.0;
+    double totalHoldingTime = 0.0;
+
+    for (const auto& trade : trades) {
+        totalPnL += trade.pnl;
+
+        if (trade.pnl > 0) {
+            result.winTrades++;
+            totalWin += trade.pnl;
+        } else {
+            result.lossTrades++;
+            totalLoss += std::abs(trade.pnl);
+        }
+
+        totalHoldingTime += (trade.exitTime - trade.entryTime) / 60000.0;  // 분 단위
+    }
+
+    // 수익률
+    result.totalReturn = totalPnL / config.dailyBudget * 100.0;
+
+    // 승률
+    result.winRate = result.totalTrades > 0 ?
+        (double)result.winTrades / result.totalTrades * 100.0 : 0.0;
+
+    // 평균 손익
+    result.avgWin = result.winTrades > 0 ? totalWin / result.winTrades : 0.0;
+    result.avgLoss = result.lossTrades > 0 ? totalLoss / result.lossTrades : 0.0;
+
+    // 손익비
+    result.profitFactor = result.avgLoss > 0 ? result.avgWin / result.avgLoss : 0.0;
+
+    // 평균 보유 시간
+    result.avgHoldingPeriod = result.totalTrades > 0 ?
+        totalHoldingTime / result.totalTrades : 0.0;
+
+    // 최대 낙폭
+    result.maxDrawdown = maxDrawdown * 100.0;
+
+    // 연환산 수익률 (가정: 250 거래일)
+    if (!equityCurve.empty()) {
+        int tradingDays = equityCurve.size();
+        result.annualizedReturn = result.totalReturn * (250.0 / tradingDays);
+    }
+
+    // 샤프 비율 (단순화)
+    if (!equityCurve.empty() && equityCurve.size() > 1) {
+        std::vector<double> dailyReturns;
+        for (size_t i = 1; i < equityCurve.size(); ++i) {
+            double ret = (equityCurve[i].second - equityCurve[i-1].second) /
+                         equityCurve[i-1].second;
+            dailyReturns.push_back(ret);
+        }
+
+        double avgReturn = 0.0;
+        for (double r : dailyReturns) avgReturn += r;
+        avgReturn /= dailyReturns.size();
+
+        double variance = 0.0;
+        for (double r : dailyReturns) {
+            variance += (r - avgReturn) * (r - avgReturn);
+        }
+        variance /= dailyReturns.size();
+        double stdDev = std::sqrt(variance);
+
+        result.sharpeRatio = stdDev > 0 ?
+            (avgReturn * std::sqrt(250.0)) / (stdDev * std::sqrt(250.0)) : 0.0;
+    }
+}
+
+} // namespace yuanta
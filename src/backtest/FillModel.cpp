@@ -0,0 +1,120 @@
+#include "../../include/FillModel.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace yuanta {
+
+// ============================================================================
+// FillModel
+// ============================================================================
+
+double FillModel::tickSize(double price) {
+    if (price < 2000.0) return 1.0;
+    if (price < 5000.0) return 5.0;
+    if (price < 20000.0) return 10.0;
+    if (price < 50000.0) return 50.0;
+    if (price < 200000.0) return 100.0;
+    if (price < 500000.0) return 500.0;
+    return 1000.0;
+}
+
+double FillModel::roundUpToTick(double price) {
+    double tick = tickSize(price);
+    // 이미 호가 단위 위에 있는 가격이 부동소수점 오차로 한 단위 올라가지 않도록 여유를 둠
+    return std::ceil(price / tick - 1e-9) * tick;
+}
+
+double FillModel::roundDownToTick(double price) {
+    double tick = tickSize(price);
+    return std::floor(price / tick + 1e-9) * tick;
+}
+
+// ============================================================================
+// CloseFillModel
+// ============================================================================
+
+ExitFill CloseFillModel::checkExit(const OHLCV& bar, double stopLoss, double takeProfit,
+                                   int quantity) const {
+    ExitFill fill;
+    if (bar.close <= stopLoss) {
+        fill.kind = ExitFill::Kind::STOP_LOSS;
+    } else if (bar.close >= takeProfit) {
+        fill.kind = ExitFill::Kind::TAKE_PROFIT;
+    }
+    if (fill.triggered()) {
+        fill.price = sellPrice(bar.close, quantity, bar.volume);
+    }
+    return fill;
+}
+
+double CloseFillModel::buyPrice(double price, int, long long) const {
+    return price * (1.0 + slippage);
+}
+
+double CloseFillModel::sellPrice(double price, int, long long) const {
+    return price * (1.0 - slippage);
+}
+
+// ============================================================================
+// IntrabarFillModel
+// ============================================================================
+
+double IntrabarFillModel::slippage(int quantity, long long barVolume) const {
+    double participation = barVolume > 0 ?
+        static_cast<double>(quantity) / static_cast<double>(barVolume) : 1.0;
+    double slip = config.baseSlippage + config.impactCoefficient * std::sqrt(participation);
+    return (std::min)(slip, config.maxSlippage);
+}
+
+double IntrabarFillModel::buyPrice(double price, int quantity, long long barVolume) const {
+    double fill = price * (1.0 + slippage(quantity, barVolume));
+    return config.roundToTick ? roundUpToTick(fill) : fill;
+}
+
+double IntrabarFillModel::sellPrice(double price, int quantity, long long barVolume) const {
+    double fill = price * (1.0 - slippage(quantity, barVolume));
+    return config.roundToTick ? roundDownToTick(fill) : fill;
+}
+
+ExitFill IntrabarFillModel::checkExit(const OHLCV& bar, double stopLoss, double takeProfit,
+                                      int quantity) const {
+    ExitFill fill;
+    double limitPrice = config.roundToTick ? roundUpToTick(takeProfit) : takeProfit;
+
+    // 시가 갭: 손절은 시가에서 시장가, 익절 지정가는 시가에 체결
+    if (bar.open <= stopLoss) {
+        fill.kind = ExitFill::Kind::STOP_LOSS;
+        fill.price = sellPrice(bar.open, quantity, bar.volume);
+        return fill;
+    }
+    if (bar.open >= limitPrice) {
+        fill.kind = ExitFill::Kind::TAKE_PROFIT;
+        fill.price = bar.open;
+        return fill;
+    }
+
+    bool stopHit = bar.low <= stopLoss;
+    bool targetHit = bar.high >= limitPrice;
+    if (!stopHit && !targetHit) return fill;
+
+    bool stopFirst = true;
+    if (stopHit && targetHit) {
+        switch (config.path) {
+            case IntrabarPath::PESSIMISTIC:   stopFirst = true; break;
+            case IntrabarPath::OPTIMISTIC:    stopFirst = false; break;
+            case IntrabarPath::BAR_DIRECTION: stopFirst = bar.close >= bar.open; break;
+        }
+    }
+
+    if (stopHit && (!targetHit || stopFirst)) {
+        fill.kind = ExitFill::Kind::STOP_LOSS;
+        fill.price = sellPrice(stopLoss, quantity, bar.volume);
+    } else {
+        fill.kind = ExitFill::Kind::TAKE_PROFIT;
+        fill.price = limitPrice;
+    }
+    return fill;
+}
+
+} // namespace yuanta
@@ -0,0 +1,198 @@
+#include "../../include/MonteCarlo.h"
+#include "../../include/ThreadPool.h"
+
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <cmath>
+
+namespace yuanta {
+
+namespace {
+
+// [0, n) 균등 정수 (상위 53비트를 실수로 변환해 곱함)
+size_t uniformIndex(uint64_t random, size_t n) {
+    double u = static_cast<double>(random >> 11) * (1.0 / 9007199254740992.0);
+    size_t index = static_cast<size_t>(u * static_cast<double>(n));
+    return (std::min)(index, n - 1);
+}
+
+// 정렬된 값에서 선형 보간 백분위
+double percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) return 0.0;
+    double pos = p * static_cast<double>(sorted.size() - 1);
+    size_t lo = static_cast<size_t>(pos);
+    size_t hi = (std::min)(lo + 1, sorted.size() - 1);
+    double frac = pos - static_cast<double>(lo);
+    return sorted[lo] + (sorted[hi] - sorted[lo]) * frac;
+}
+
+} // namespace
+
+MonteCarloSimulator::MonteCarloSimulator(ThreadPool& pool) : pool(pool) {}
+
+uint64_t MonteCarloSimulator::counterRandom(uint64_t key, uint64_t counter) {
+    // SplitMix64 출력 함수: 상태 = key + (counter + 1) * 황금비 상수
+    uint64_t z = key + (counter + 1) * 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+MonteCarloResult MonteCarloSimulator::run(const std::vector<BacktestTrade>& trades,
+                                          const MonteCarloConfig& config) const {
+    MonteCarloResult result;
+    result.confidence = config.confidence;
+
+    if (trades.empty() || config.resamples == 0 || config.initialCapital <= 0.0) {
+        std::cerr << "Monte Carlo needs at least one trade and one resample" << std::endl;
+        return result;
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    std::vector<double> pnl;
+    pnl.reserve(trades.size());
+    for (const auto& trade : trades) {
+        pnl.push_back(trade.pnl);
+    }
+
+    result.resamples = config.resamples;
+    result.tradesPerPath = pnl.size();
+    result.returns.resize(config.resamples);
+    result.drawdowns.resize(config.resamples);
+
+    // 구간별로 나눠 병렬 실행 (각 구간은 자기 위치에만 기록하므로 잠금 없음)
+    size_t chunk = (std::max)(size_t(256), config.resamples / ((std::max)(pool.size(), size_t(1)) * 8));
+    std::vector<std::future<void>> futures;
+    for (size_t first = 0; first < config.resamples; first += chunk) {
+        size_t last = (std::min)(first + chunk, config.resamples);
+        futures.push_back(pool.submit([&pnl, &config, &result, first, last]() {
+            simulateRange(pnl, config, first, last, result);
+        }));
+    }
+    for (auto& future : futures) {
+        future.get();
+    }
+
+    size_t ruined = 0;
+    size_t losses = 0;
+    for (size_t r = 0; r < config.resamples; ++r) {
+        if (result.drawdowns[r] >= config.ruinDrawdown) ruined++;
+        if (result.returns[r] < 0.0) losses++;
+    }
+    result.riskOfRuin = 100.0 * static_cast<double>(ruined) / static_cast<double>(config.resamples);
+    result.probabilityOfLoss = 100.0 * static_cast<double>(losses) / static_cast<double>(config.resamples);
+
+    result.totalReturn = summarize(result.returns, config.confidence);
+    result.maxDrawdown = summarize(result.drawdowns, config.confidence);
+
+    result.elapsedMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - startTime).count();
+    return result;
+}
+
+void MonteCarloSimulator::simulateRange(const std::vector<double>& pnl,
+                                        const MonteCarloConfig& config,
+                                        size_t first, size_t last, MonteCarloResult& out) {
+    size_t n = pnl.size();
+    size_t block = (std::max)(size_t(1), (std::min)(config.blockSize, n));
+    std::vector<double> order;
+    if (config.method == MonteCarloConfig::Method::SHUFFLE) {
+        order.resize(n);
+    }
+
+    for (size_t r = first; r < last; ++r) {
+        // 재표본마다 독립된 키, 추출마다 카운터 증가
+        uint64_t key = counterRandom(config.seed, r);
+        uint64_t draw = 0;
+
+        double equity = config.initialCapital;
+        double peak = equity;
+        double maxDrawdown = 0.0;
+        auto step = [&](double value) {
+            equity += value;
+            if (equity > peak) peak = equity;
+            double drawdown = equity > 0.0 ? (peak - equity) / peak * 100.0 : 100.0;
+            if (drawdown > maxDrawdown) maxDrawdown = drawdown;
+        };
+
+        switch (config.method) {
+            case MonteCarloConfig::Method::BOOTSTRAP:
+                for (size_t k = 0; k < n; ++k) {
+                    step(pnl[uniformIndex(counterRandom(key, draw++), n)]);
+                }
+                break;
+
+            case MonteCarloConfig::Method::BLOCK_BOOTSTRAP: {
+                // 순환 블록 부트스트랩: 임의 시작점부터 연속 block개 (끝에서는 처음으로 이어짐)
+                size_t start = 0;
+                for (size_t k = 0; k < n; ++k) {
+                    if (k % block == 0) {
+                        start = uniformIndex(counterRandom(key, draw++), n);
+                    }
+                    step(pnl[(start + k % block) % n]);
+                }
+                break;
+            }
+
+            case MonteCarloConfig::Method::SHUFFLE:
+                // Fisher-Yates
+                std::copy(pnl.begin(), pnl.end(), order.begin());
+                for (size_t i = n - 1; i > 0; --i) {
+                    std::swap(order[i], order[uniformIndex(counterRandom(key, draw++), i + 1)]);
+                }
+                for (double value : order) {
+                    step(value);
+                }
+                break;
+        }
+
+        out.returns[r] = (equity - config.initialCapital) / config.initialCapital * 100.0;
+        out.drawdowns[r] = maxDrawdown;
+    }
+}
+
+MonteCarloDistribution MonteCarloSimulator::summarize(std::vector<double> values,
+                                                      double confidence) {
+    MonteCarloDistribution dist;
+    if (values.empty()) return dist;
+
+    std::sort(values.begin(), values.end());
+
+    double sum = 0.0;
+    for (double v : values) sum += v;
+    dist.mean = sum / static_cast<double>(values.size());
+
+    double sq = 0.0;
+    for (double v : values) sq += (v - dist.mean) * (v - dist.mean);
+    dist.stdDev = std::sqrt(sq / static_cast<double>(values.size()));
+
+    double tail = (1.0 - (std::min)((std::max)(confidence, 0.0), 1.0)) / 2.0;
+    dist.lower = percentile(values, tail);
+    dist.median = percentile(values, 0.5);
+    dist.upper = percentile(values, 1.0 - tail);
+    dist.min = values.front();
+    dist.max = values.back();
+    return dist;
+}
+
+bool MonteCarloSimulator::writePaths(const std::string& path, const MonteCarloResult& result) {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "Failed to create file: " << path << std::endl;
+        return false;
+    }
+
+    file << "Resample,TotalReturn,MaxDrawdown\n";
+    for (size_t r = 0; r < result.returns.size(); ++r) {
+        file << (r + 1) << "," << result.returns[r] << "," << result.drawdowns[r] << "\n";
+    }
+
+    std::cout << "Monte Carlo paths saved to " << path << std::endl;
+    return true;
+}
+
+} // namespace yuanta
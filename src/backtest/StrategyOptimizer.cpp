@@ -0,0 +1,352 @@
+#include "../../include/StrategyOptimizer.h"
+#include "../../include/ThreadPool.h"
+
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <random>
+#include <set>
+#include <cmath>
+
+namespace yuanta {
+
+namespace {
+
+// 범위 안의 격자점 개수 (step <= 0이면 최솟값 하나)
+size_t stepCount(const ParameterRange& range) {
+    if (range.step <= 0.0 || range.maxValue <= range.minValue) return 1;
+    // 부동소수점 오차로 마지막 값이 빠지지 않도록 여유를 둠
+    return static_cast<size_t>(std::floor((range.maxValue - range.minValue) / range.step + 1e-9)) + 1;
+}
+
+double valueAt(const ParameterRange& range, size_t index) {
+    return range.minValue + range.step * static_cast<double>(index);
+}
+
+} // namespace
+
+StrategyOptimizer::StrategyOptimizer(const Backtester& data, ThreadPool& pool)
+    : data(data), pool(pool) {}
+
+std::vector<ParameterSet> StrategyOptimizer::gridCombinations(
+    const std::vector<ParameterRange>& ranges, size_t maxCombinations) {
+
+    std::vector<ParameterSet> combos;
+
+    size_t total = 1;
+    for (const auto& range : ranges) {
+        total *= stepCount(range);
+        if (total > maxCombinations) {
+            std::cerr << "Too many parameter combinations (max " << maxCombinations << ")"
+                      << std::endl;
+            return combos;
+        }
+    }
+
+    // 혼합 진법 카운터로 전 조합 열거 (마지막 파라미터가 가장 빨리 바뀜)
+    std::vector<size_t> index(ranges.size(), 0);
+    combos.reserve(total);
+    for (size_t n = 0; n < total; ++n) {
+        ParameterSet params;
+        for (size_t i = 0; i < ranges.size(); ++i) {
+            params[ranges[i].name] = valueAt(ranges[i], index[i]);
+        }
+        combos.push_back(std::move(params));
+
+        for (size_t i = ranges.size(); i-- > 0;) {
+            if (++index[i] < stepCount(ranges[i])) break;
+            index[i] = 0;
+        }
+    }
+    return combos;
+}
+
+std::vector<ParameterSet> StrategyOptimizer::randomCombinations(
+    const std::vector<ParameterRange>& ranges, size_t count, uint64_t seed) {
+
+    std::vector<ParameterSet> combos;
+    combos.reserve(count);
+
+    // 격자점 위에서 균등 추출 (step <= 0이면 연속 구간에서 추출)
+    // 이미 뽑은 조합은 건너뛰며, 조합 공간이 작으면 count보다 적게 반환될 수 있다.
+    std::mt19937_64 rng(seed);
+    std::set<ParameterSet> seen;
+    for (size_t attempt = 0; combos.size() < count && attempt < count * 20; ++attempt) {
+        ParameterSet params;
+        for (const auto& range : ranges) {
+            if (range.step > 0.0) {
+                std::uniform_int_distribution<size_t> pick(0, stepCount(range) - 1);
+                params[range.name] = valueAt(range, pick(rng));
+            } else {
+                std::uniform_real_distribution<double> pick(range.minValue,
+                    (std::max)(range.minValue, range.maxValue));
+                params[range.name] = pick(rng);
+            }
+        }
+        if (seen.insert(params).second) {
+            combos.push_back(std::move(params));
+        }
+    }
+    return combos;
+}
+
+double StrategyOptimizer::score(const BacktestResult& result, OptimizerConfig::RankBy rankBy) {
+    switch (rankBy) {
+        case OptimizerConfig::RankBy::PROFIT_FACTOR: return result.profitFactor;
+        case OptimizerConfig::RankBy::DRAWDOWN:      return -result.maxDrawdown;
+        case OptimizerConfig::RankBy::SHARPE:
+        default:                                     return result.sharpeRatio;
+    }
+}
+
+std::vector<ParameterSet> StrategyOptimizer::combinations(const OptimizerConfig& config) const {
+    return (config.mode == OptimizerConfig::Mode::GRID) ?
+        gridCombinations(config.ranges, config.maxCombinations) :
+        randomCombinations(config.ranges, config.randomSamples, config.seed);
+}
+
+void StrategyOptimizer::rank(std::vector<OptimizationResult>& results,
+                             const OptimizerConfig& config) {
+    for (auto& r : results) {
+        r.score = score(r.result, config.rankBy);
+    }
+
+    // 최소 거래 수를 채운 조합 우선, 그 안에서 점수 내림차순 (안정 정렬로 동점 순서 고정)
+    std::stable_sort(results.begin(), results.end(),
+        [&config](const OptimizationResult& a, const OptimizationResult& b) {
+            bool aValid = a.result.totalTrades >= config.minTrades;
+            bool bValid = b.result.totalTrades >= config.minTrades;
+            if (aValid != bValid) return aValid;
+            return a.score > b.score;
+        });
+}
+
+bool StrategyOptimizer::validateRanges(const std::string& strategyName,
+                                       const std::vector<ParameterRange>& ranges) {
+    std::unique_ptr<Strategy> strategy = Backtester::createStrategy(strategyName);
+    if (!strategy) {
+        std::cerr << "Unknown strategy: " << strategyName << std::endl;
+        return false;
+    }
+
+    bool valid = true;
+    for (const auto& range : ranges) {
+        if (!strategy->hasParameter(range.name)) {
+            std::cerr << "Unknown parameter for " << strategyName << ": " << range.name << std::endl;
+            valid = false;
+        }
+    }
+    if (!valid) {
+        std::cerr << "Known parameters:";
+        for (const auto& name : strategy->parameterNames()) {
+            std::cerr << " " << name;
+        }
+        std::cerr << std::endl;
+    }
+    return valid;
+}
+
+std::vector<OptimizationResult> StrategyOptimizer::optimize(const OptimizerConfig& config) const {
+    if (!validateRanges(config.strategyName, config.ranges)) return {};
+
+    std::vector<ParameterSet> combos = combinations(config);
+
+    std::vector<BacktestJob> jobs;
+    jobs.reserve(combos.size());
+    for (auto& params : combos) {
+        BacktestJob job;
+        job.strategyName = config.strategyName;
+        job.codes = config.codes;
+        job.parameters = std::move(params);
+        jobs.push_back(std::move(job));
+    }
+
+    std::cout << "Evaluating " << jobs.size() << " parameter combinations for "
+              << config.strategyName << " on " << pool.size() << " threads..." << std::endl;
+
+    std::vector<BacktestJobResult> jobResults = data.runParallel(jobs, pool);
+
+    std::vector<OptimizationResult> results;
+    results.reserve(jobResults.size());
+    for (auto& jobResult : jobResults) {
+        OptimizationResult r;
+        r.parameters = std::move(jobResult.job.parameters);
+        r.result = jobResult.result;
+        results.push_back(std::move(r));
+    }
+
+    rank(results, config);
+    return results;
+}
+
+WalkForwardResult StrategyOptimizer::walkForward(const WalkForwardConfig& config) const {
+    WalkForwardResult wf;
+
+    const OptimizerConfig& opt = config.optimizer;
+    if (!validateRanges(opt.strategyName, opt.ranges)) return wf;
+
+    size_t totalDays = data.tradingDays(opt.codes);
+    size_t step = config.stepDays > 0 ? config.stepDays : config.outOfSampleDays;
+
+    if (config.inSampleDays == 0 || config.outOfSampleDays == 0 || step == 0) {
+        std::cerr << "Invalid walk-forward window sizes" << std::endl;
+        return wf;
+    }
+
+    // 구간 배치: 학습 [s, s+IS), 검증 [s+IS, s+IS+OOS)
+    for (size_t start = 0;
+         start + config.inSampleDays + config.outOfSampleDays <= totalDays;
+         start += step) {
+        WalkForwardWindow window;
+        window.inSampleStart = start;
+        window.outOfSampleStart = start + config.inSampleDays;
+        window.outOfSampleDays = config.outOfSampleDays;
+        wf.windows.push_back(window);
+    }
+    if (wf.windows.empty()) {
+        std::cerr << "Not enough history for walk-forward (" << totalDays << " days)" << std::endl;
+        return wf;
+    }
+
+    std::vector<ParameterSet> combos = combinations(opt);
+    if (combos.empty()) return wf;
+
+    auto makeJob = [&](const ParameterSet& params, size_t firstDay, size_t dayCount) {
+        BacktestJob job;
+        job.strategyName = opt.strategyName;
+        job.codes = opt.codes;
+        job.parameters = params;
+        job.firstDay = firstDay;
+        job.dayCount = dayCount;
+        job.warmupDays = config.warmupDays;
+        return job;
+    };
+
+    // 1단계: 전 구간 × 전 조합 학습 평가 (구간 순, 조합 순)
+    std::vector<BacktestJob> jobs;
+    jobs.reserve(wf.windows.size() * combos.size());
+    for (const auto& window : wf.windows) {
+        for (const auto& params : combos) {
+            jobs.push_back(makeJob(params, window.inSampleStart, config.inSampleDays));
+        }
+    }
+
+    std::cout << "Walk-forward: " << wf.windows.size() << " windows x " << combos.size()
+              << " combinations on " << pool.size() << " threads..." << std::endl;
+
+    std::vector<BacktestJobResult> inSample = data.runParallel(jobs, pool);
+
+    for (size_t w = 0; w < wf.windows.size(); ++w) {
+        std::vector<OptimizationResult> ranked;
+        ranked.reserve(combos.size());
+        for (size_t c = 0; c < combos.size(); ++c) {
+            OptimizationResult r;
+            r.parameters = combos[c];
+            r.result = inSample[w * combos.size() + c].result;
+            ranked.push_back(std::move(r));
+        }
+        rank(ranked, opt);
+
+        wf.windows[w].parameters = ranked.front().parameters;
+        wf.windows[w].inSample = ranked.front().result;
+    }
+
+    // 2단계: 구간별 최적 파라미터로 검증 구간 평가
+    jobs.clear();
+    for (const auto& window : wf.windows) {
+        jobs.push_back(makeJob(window.parameters, window.outOfSampleStart, window.outOfSampleDays));
+    }
+    std::vector<BacktestJobResult> outOfSample = data.runParallel(jobs, pool);
+
+    // 검증 구간 자산 곡선을 복리로 연결 (각 구간은 초기 자금에서 시작)
+    // 다음 구간은 앞 구간의 수익률(마지막 청산까지 포함)만큼 불어난 자금에서 이어진다.
+    double scale = 1.0;
+    for (size_t w = 0; w < wf.windows.size(); ++w) {
+        BacktestJobResult& r = outOfSample[w];
+        wf.windows[w].outOfSample = r.result;
+
+        wf.trades.insert(wf.trades.end(), r.trades.begin(), r.trades.end());
+        for (const auto& point : r.equityCurve) {
+            wf.equityCurve.push_back({point.first, point.second * scale});
+        }
+        scale *= 1.0 + r.result.totalReturn / 100.0;
+    }
+
+    // 통합 수익률은 구간 손익의 단순 합이 아니라 위 곡선과 같은 복리 연결 값
+    wf.aggregate = Backtester::summarize(wf.trades, wf.equityCurve);
+    wf.aggregate.totalReturn = (scale - 1.0) * 100.0;
+    if (!wf.equityCurve.empty()) {
+        wf.aggregate.annualizedReturn = wf.aggregate.totalReturn *
+            (250.0 / static_cast<double>(wf.equityCurve.size()));
+    }
+    return wf;
+}
+
+bool StrategyOptimizer::writeResults(const std::string& path,
+                                     const std::vector<OptimizationResult>& results) {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "Failed to create file: " << path << std::endl;
+        return false;
+    }
+
+    file << "Rank";
+    if (!results.empty()) {
+        for (const auto& [name, value] : results.front().parameters) {
+            file << "," << name;
+        }
+    }
+    file << ",Score,TotalReturn,Sharpe,ProfitFactor,MaxDrawdown,WinRate,Trades\n";
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        const OptimizationResult& r = results[i];
+        file << (i + 1);
+        for (const auto& [name, value] : r.parameters) {
+            file << "," << value;
+        }
+        file << "," << r.score
+             << "," << r.result.totalReturn
+             << "," << r.result.sharpeRatio
+             << "," << r.result.profitFactor
+             << "," << r.result.maxDrawdown
+             << "," << r.result.winRate
+             << "," << r.result.totalTrades << "\n";
+    }
+
+    std::cout << "Optimization results saved to " << path << std::endl;
+    return true;
+}
+
+bool StrategyOptimizer::writeWalkForward(const std::string& path,
+                                         const WalkForwardResult& result) {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "Failed to create file: " << path << std::endl;
+        return false;
+    }
+
+    file << "Window,InSampleStart,OutOfSampleStart,OutOfSampleDays,Parameters,"
+         << "InSampleSharpe,InSampleReturn,OutOfSampleSharpe,OutOfSampleReturn,"
+         << "OutOfSampleMaxDrawdown,OutOfSampleTrades\n";
+
+    for (size_t i = 0; i < result.windows.size(); ++i) {
+        const WalkForwardWindow& w = result.windows[i];
+        file << (i + 1) << "," << w.inSampleStart << "," << w.outOfSampleStart << ","
+             << w.outOfSampleDays << ",";
+
+        bool firstParam = true;
+        for (const auto& [name, value] : w.parameters) {
+            file << (firstParam ? "" : " ") << name << "=" << value;
+            firstParam = false;
+        }
+
+        file << "," << w.inSample.sharpeRatio << "," << w.inSample.totalReturn
+             << "," << w.outOfSample.sharpeRatio << "," << w.outOfSample.totalReturn
+             << "," << w.outOfSample.maxDrawdown << "," << w.outOfSample.totalTrades << "\n";
+    }
+
+    std::cout << "Walk-forward results saved to " << path << std::endl;
+    return true;
+}
+
+} // namespace yuanta
@@ -0,0 +1,417 @@
+#include "../../include/TickReplayer.h"
+#include "../../include/BarStream.h"
+#include "../../include/BarIndex.h"
+
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <cstdlib>
+#include <algorithm>
+
+namespace yuanta {
+
+TickReplayer::TickReplayer(const ReplayConfig& config) : config(config) {
+    if (!this->config.fillModel) {
+        this->config.fillModel = std::make_shared<IntrabarFillModel>();
+    }
+}
+
+ReplayResult TickReplayer::replayBars(const BarHistory& history,
+                                      const std::vector<std::string>& codes) {
+    std::vector<std::string> selected;
+    MergedBarStream stream;
+    stream.reserve(history.size());
+
+    for (const auto& [code, candles] : history) {
+        if (!codes.empty() && std::find(codes.begin(), codes.end(), code) == codes.end()) {
+            continue;
+        }
+        selected.push_back(code);
+        stream.addSeries(candles);
+    }
+
+    Session session;
+    if (!beginSession(session, selected)) {
+        return session.out;
+    }
+
+    // 전략/리스크의 장 시간 판단이 틱 시각을 따르도록 이 스레드의 시계를 교체
+    ScopedClock clockScope(clock);
+
+    int ticksPerBar = (std::max)(config.ticksPerBar, 1);
+    long long tickSpacing = 60000LL / ticksPerBar;
+    auto startTime = std::chrono::steady_clock::now();
+
+    // 같은 시각의 봉을 묶어서, 틱 단계별로 전 종목을 번갈아 내보냄 (틱 시각순 유지)
+    std::vector<MergedBarStream::Event> group;
+    group.reserve(selected.size());
+    MergedBarStream::Event event;
+    bool hasEvent = stream.next(event);
+
+    while (hasEvent) {
+        group.clear();
+        long long barTime = event.bar->timestamp;
+        do {
+            group.push_back(event);
+            hasEvent = stream.next(event);
+        } while (hasEvent && event.bar->timestamp == barTime);
+
+        for (int k = 0; k < ticksPerBar; ++k) {
+            for (const auto& e : group) {
+                const OHLCV& bar = *e.bar;
+
+                // 가격 경로: 시가 → (양봉이면 저가, 음봉이면 고가) → 반대 극값 → 종가
+                double price = bar.close;
+                if (ticksPerBar > 1) {
+                    bool bullish = bar.close >= bar.open;
+                    double path[4] = {bar.open, bullish ? bar.low : bar.high,
+                                      bullish ? bar.high : bar.low, bar.close};
+                    double f = 3.0 * k / (ticksPerBar - 1);
+                    int seg = (std::min)(static_cast<int>(f), 2);
+                    price = path[seg] + (path[seg + 1] - path[seg]) * (f - seg);
+                }
+
+                // 거래량은 균등 분배 (나머지는 마지막 틱)
+                long long volume = bar.volume / ticksPerBar;
+                if (k == ticksPerBar - 1) {
+                    volume += bar.volume % ticksPerBar;
+                }
+
+                onTick(session, static_cast<uint32_t>(e.series),
+                       bar.timestamp + k * tickSpacing, price, volume);
+            }
+        }
+    }
+
+    session.out.elapsedMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - startTime).count();
+    finishSession(session);
+    return session.out;
+}
+
+ReplayResult TickReplayer::replayTicks(const std::vector<std::string>& codes,
+                                       const std::vector<ReplayTick>& ticks) {
+    Session session;
+    if (!beginSession(session, codes)) {
+        return session.out;
+    }
+
+    ScopedClock clockScope(clock);
+
+    auto startTime = std::chrono::steady_clock::now();
+    for (const auto& tick : ticks) {
+        if (tick.symbol >= session.symbols.size()) continue;
+        onTick(session, tick.symbol, tick.timestamp, tick.price, tick.volume);
+    }
+
+    session.out.elapsedMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - startTime).count();
+    finishSession(session);
+    return session.out;
+}
+
+bool TickReplayer::loadTicks(const std::string& filepath,
+                             std::vector<std::string>& codes,
+                             std::vector<ReplayTick>& ticks) {
+    std::ifstream file(filepath);
+    if (!file.is_open()) {
+        std::cerr << "Failed to open: " << filepath << std::endl;
+        return false;
+    }
+
+    std::map<std::string, uint32_t> index;
+    for (size_t i = 0; i < codes.size(); ++i) {
+        index[codes[i]] = static_cast<uint32_t>(i);
+    }
+
+    std::string line;
+    size_t lineNo = 0;
+    size_t malformed = 0;
+    bool sorted = true;
+    while (std::getline(file, line)) {
+        lineNo++;
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.empty()) continue;
+
+        size_t c1 = line.find(',');
+        size_t c2 = c1 == std::string::npos ? c1 : line.find(',', c1 + 1);
+        size_t c3 = c2 == std::string::npos ? c2 : line.find(',', c2 + 1);
+
+        char* end = nullptr;
+        ReplayTick tick;
+        tick.timestamp = std::strtoll(line.c_str(), &end, 10);
+        bool ok = c3 != std::string::npos && end == line.c_str() + c1;
+        if (ok) {
+            tick.price = std::strtod(line.c_str() + c2 + 1, &end);
+            ok = end == line.c_str() + c3 && tick.price > 0;
+        }
+        if (ok) {
+            tick.volume = std::strtoll(line.c_str() + c3 + 1, &end, 10);
+            ok = end != line.c_str() + c3 + 1 && tick.volume >= 0;
+        }
+        if (!ok) {
+            if (lineNo > 1) {    // 첫 줄은 헤더일 수 있음
+                malformed++;
+                std::cerr << "Malformed tick at line " << lineNo << std::endl;
+            }
+            continue;
+        }
+
+        std::string code = line.substr(c1 + 1, c2 - c1 - 1);
+        auto it = index.find(code);
+        if (it == index.end()) {
+            it = index.emplace(code, static_cast<uint32_t>(codes.size())).first;
+            codes.push_back(code);
+        }
+        tick.symbol = it->second;
+
+        if (!ticks.empty() && tick.timestamp < ticks.back().timestamp) {
+            sorted = false;
+        }
+        ticks.push_back(tick);
+    }
+
+    if (!sorted) {
+        std::stable_sort(ticks.begin(), ticks.end(),
+            [](const ReplayTick& a, const ReplayTick& b) { return a.timestamp < b.timestamp; });
+    }
+
+    std::cout << "Loaded " << ticks.size() << " ticks for " << codes.size() << " symbols";
+    if (malformed > 0) {
+        std::cout << " (" << malformed << " malformed lines skipped)";
+    }
+    std::cout << std::endl;
+    return !ticks.empty();
+}
+
+bool TickReplayer::beginSession(Session& session, const std::vector<std::string>& codes) {
+    if (codes.empty()) {
+        std::cerr << "No symbols to replay" << std::endl;
+        return false;
+    }
+
+    // 전략 구성 (실거래와 같은 StrategyManager)
+    std::vector<std::string> names = config.strategies;
+    if (names.empty()) {
+        names = {"GapPullback", "MABreakout", "BBSqueeze"};
+    }
+    for (const auto& name : names) {
+        std::unique_ptr<Strategy> strategy = config.strategyFactory ?
+            config.strategyFactory(name) : Backtester::createStrategy(name);
+        if (!strategy) {
+            std::cerr << "Unknown strategy: " << name << std::endl;
+            return false;
+        }
+        for (const auto& [param, value] : config.parameters) {
+            strategy->setParameter(param, value);
+        }
+        session.strategyManager.addStrategy(std::move(strategy));
+    }
+
+    session.symbols.resize(codes.size());
+    for (size_t i = 0; i < codes.size(); ++i) {
+        session.dataManager.addWatchlist(codes[i]);
+
+        ReplaySymbol& sym = session.symbols[i];
+        sym.code = codes[i];
+        sym.quote.code = codes[i];
+        sym.quote.symbolId = SymbolRegistry::instance().find(codes[i]);
+    }
+
+    // 분봉 완성 → 공유 지표 캐시 무효화 (실거래 콜백과 동일), 1분봉은 평가 예약
+    session.dataManager.setCandleCompleteCallback(
+        [this, &session](const std::string& code, int minutes, const OHLCV& candle) {
+            session.strategyManager.onCandleComplete(code, minutes);
+            if (minutes == 1) {
+                session.minuteClosed = true;
+                session.closedVolume = candle.volume;
+                if (config.onMinuteCandle) {
+                    config.onMinuteCandle(code, candle);
+                }
+            }
+        });
+
+    session.cash = Backtester::INITIAL_CASH;
+    return true;
+}
+
+void TickReplayer::onTick(Session& session, uint32_t index, long long timestamp,
+                          double price, long long volume) {
+    ReplaySymbol& sym = session.symbols[index];
+    clock.set(timestamp);
+
+    // 거래일이 바뀌면 전일 마감 자산 기록
+    long long day = DayIndex::dayStart(timestamp);
+    if (session.lastDay >= 0 && day != session.lastDay) {
+        recordEquity(session, session.lastTime);
+    }
+    session.lastDay = day;
+    session.lastTime = timestamp;
+
+    // 거래소 시세처럼 당일 시가/고가/저가/누적 거래량 유지
+    QuoteData& quote = sym.quote;
+    bool firstTick = sym.day < 0;
+    if (sym.day != day) {
+        quote.prevClose = sym.lastPrice > 0 ? sym.lastPrice : price;
+        quote.prevVolume = quote.volume;
+        quote.openPrice = price;
+        quote.highPrice = price;
+        quote.lowPrice = price;
+        quote.volume = 0;
+        sym.day = day;
+    }
+    quote.currentPrice = price;
+    quote.highPrice = (std::max)(quote.highPrice, price);
+    quote.lowPrice = (std::min)(quote.lowPrice, price);
+    quote.volume += volume;
+    quote.changeRate = (price - quote.prevClose) / quote.prevClose * 100.0;
+    quote.timestamp = timestamp;
+    sym.lastPrice = price;
+    session.out.ticks++;
+
+    // 실거래와 같은 분봉 집계 (완성 시 콜백에서 minuteClosed 설정)
+    session.minuteClosed = false;
+    if (firstTick) {
+        // 분봉 집계는 첫 시세의 누적 거래량을 기준점으로만 쓰므로, 같은 가격의
+        // 누적 0 시세를 먼저 넣어 첫 틱 체결량이 첫 봉에 포함되게 함
+        long long cumulative = quote.volume;
+        quote.volume = 0;
+        session.dataManager.processQuote(quote);
+        quote.volume = cumulative;
+    }
+    session.dataManager.processQuote(quote);
+    if (session.minuteClosed) {
+        sym.barVolume = session.closedVolume;
+    }
+
+    // 손절/익절은 틱마다 확인 (틱 = 시가/고가/저가/종가가 모두 체결가인 봉)
+    if (sym.holding) {
+        OHLCV tickBar{price, price, price, price, sym.barVolume, timestamp};
+        ExitFill fill = config.fillModel->checkExit(tickBar, sym.stopLoss, sym.takeProfit1,
+                                                    sym.quantity);
+        if (fill.triggered()) {
+            exitPosition(session, sym, fill.price, timestamp,
+                         fill.kind == ExitFill::Kind::STOP_LOSS ? "StopLoss" : "TakeProfit");
+        }
+    }
+
+    if (session.minuteClosed) {
+        evaluate(session, index);
+    }
+}
+
+void TickReplayer::evaluate(Session& session, uint32_t index) {
+    ReplaySymbol& sym = session.symbols[index];
+    session.out.candles++;
+
+    // 실거래 평가 핸들러와 같은 입력: 최근 100개 1분봉 + 최신 시세 스냅샷
+    session.dataManager.getMinuteCandles(sym.quote.symbolId, 1, 100, session.evalCandles);
+    if (session.evalCandles.empty()) return;
+    QuoteData quote = session.dataManager.getQuote(sym.quote.symbolId);
+
+    if (sym.holding) {
+        // 전략별 청산 조건
+        Position position{};
+        position.code = sym.code;
+        position.quantity = sym.quantity;
+        position.avgPrice = sym.entryPrice;
+        position.currentPrice = quote.currentPrice;
+        position.stopLossPrice = sym.stopLoss;
+        position.takeProfitPrice1 = sym.takeProfit1;
+        position.takeProfitPrice2 = sym.takeProfit2;
+        position.remainingQty = sym.quantity;
+
+        std::map<std::string, Position> positions{{sym.code, position}};
+        std::map<std::string, QuoteData> quotes{{sym.code, quote}};
+        if (!session.strategyManager.checkCloseConditions(positions, quotes).empty()) {
+            exitPosition(session, sym,
+                         config.fillModel->sellPrice(quote.currentPrice, sym.quantity, sym.barVolume),
+                         quote.timestamp, "StrategyClose");
+        }
+        return;
+    }
+
+    session.out.evaluations++;
+    auto signals = session.strategyManager.analyzeAll(sym.code, session.evalCandles, quote);
+
+    for (const auto& signal : signals) {
+        if (signal.signal != Signal::BUY) continue;
+
+        // 백테스터와 같은 계좌 규칙 (종목당 비중, 동시 보유 한도, 현금)
+        double maxPosition = session.cash * config.budget.maxPositionRatio;
+        int qty = static_cast<int>(maxPosition / quote.currentPrice);
+        if (qty <= 0 ||
+            session.openCount >= static_cast<size_t>(config.budget.maxConcurrentPositions)) {
+            break;
+        }
+
+        double fillPrice = config.fillModel->buyPrice(quote.currentPrice, qty, sym.barVolume);
+        double cost = fillPrice * qty * (1.0 + config.commission);
+        if (cost > session.cash) break;
+
+        sym.holding = true;
+        sym.quantity = qty;
+        sym.entryPrice = fillPrice;
+        sym.entryTime = quote.timestamp;
+        sym.stopLoss = signal.stopLoss > 0 ? signal.stopLoss : fillPrice * (1.0 - 0.01);
+        sym.takeProfit1 = signal.takeProfit1 > 0 ? signal.takeProfit1 : fillPrice * (1.0 + 0.02);
+        sym.takeProfit2 = signal.takeProfit2;
+        sym.strategy = signal.strategy;
+
+        session.cash -= cost;
+        session.openCount++;
+        break;
+    }
+}
+
+void TickReplayer::exitPosition(Session& session, ReplaySymbol& sym, double fillPrice,
+                                long long timestamp, const char* reason) {
+    double proceeds = sym.quantity * fillPrice;
+    proceeds -= proceeds * (config.commission + config.tax);
+    session.cash += proceeds;
+
+    BacktestTrade trade;
+    trade.code = sym.code;
+    trade.entryTime = sym.entryTime;
+    trade.exitTime = timestamp;
+    trade.entryPrice = sym.entryPrice;
+    trade.exitPrice = fillPrice;
+    trade.quantity = sym.quantity;
+    trade.pnl = proceeds - sym.entryPrice * sym.quantity;
+    trade.pnlPercent = (fillPrice - sym.entryPrice) / sym.entryPrice * 100.0;
+    trade.strategy = sym.strategy;
+    trade.exitReason = reason;
+    session.out.trades.push_back(trade);
+
+    sym.holding = false;
+    session.openCount--;
+}
+
+void TickReplayer::recordEquity(Session& session, long long timestamp) {
+    double equity = session.cash;
+    for (const auto& sym : session.symbols) {
+        if (sym.holding) {
+            equity += sym.quantity * sym.lastPrice;
+        }
+    }
+    session.out.equityCurve.push_back({timestamp, equity});
+}
+
+void TickReplayer::finishSession(Session& session) {
+    if (session.lastDay >= 0) {
+        recordEquity(session, session.lastTime);
+    }
+
+    // 남은 포지션은 마지막 체결가로 청산
+    for (auto& sym : session.symbols) {
+        if (sym.holding) {
+            exitPosition(session, sym,
+                         config.fillModel->sellPrice(sym.lastPrice, sym.quantity, sym.barVolume),
+                         session.lastTime, "EndOfTest");
+        }
+    }
+
+    session.out.result = Backtester::summarize(session.out.trades, session.out.equityCurve);
+}
+
+} // namespace yuanta
@@ -0,0 +1,59 @@
+#include "../../include/Clock.h"
+
+namespace yuanta {
+
+namespace {
+
+constexpr long long DAY_MS = 24LL * 60 * 60 * 1000;
+
+const SystemClock& systemClock() {
+    static SystemClock clock;
+    return clock;
+}
+
+thread_local const Clock* threadClock = nullptr;
+
+} // namespace
+
+SessionTime SessionTime::fromEpochMs(long long epochMs) {
+    long long local = epochMs + KST_OFFSET_MS;
+    long long day = local / DAY_MS;
+    long long msOfDay = local % DAY_MS;
+    if (msOfDay < 0) {      // 1970년 이전
+        msOfDay += DAY_MS;
+        day--;
+    }
+
+    SessionTime t;
+    t.minuteOfDay = static_cast<int>(msOfDay / 60000);
+    t.weekday = static_cast<int>(((day + 4) % 7 + 7) % 7);   // 1970-01-01은 목요일
+    return t;
+}
+
+SessionTime SystemClock::session() const {
+    long long ms = nowMs();
+    long long second = ms / 1000;
+
+    long long packed = cached.load(std::memory_order_relaxed);
+    if (packed >= 0 && (packed >> 16) == second) {
+        return SessionTime::unpack(static_cast<int>(packed & 0xFFFF));
+    }
+
+    SessionTime t = SessionTime::fromEpochMs(ms);
+    cached.store((second << 16) | t.pack(), std::memory_order_relaxed);
+    return t;
+}
+
+const Clock& currentClock() {
+    return threadClock ? *threadClock : systemClock();
+}
+
+ScopedClock::ScopedClock(const Clock& clock) : previous(threadClock) {
+    threadClock = &clock;
+}
+
+ScopedClock::~ScopedClock() {
+    threadClock = previous;
+}
+
+} // namespace yuanta
@@ -1,4 +1,5 @@
 #include "../../include/OrderExecutor.h"
+#include "../../include/Clock.h"
 #include <iostream>
 #include <sstream>
 #include <random>
@@ -540,14 +541,8 @@ void StopLossMonitor::checkTakeProfit(const Position& pos, const QuoteData& quot
 }
 
 void StopLossMonitor::checkTimeStop(const Position& pos) {
-    auto now = std::chrono::system_clock::now();
-    std::time_t t = std::chrono::system_clock::to_time_t(now);
-    std::tm* tm = std::localtime(&t);
-
-    int minutes = tm->tm_hour * 60 + tm->tm_min;
-
     // 14:30 이후 강제 청산
-    if (minutes >= 870) {
+    if (currentClock().session().minuteOfDay >= SessionTime::TIME_STOP) {
         std::cout << "Time Stop triggered for " << pos.code << std::endl;
         executor->closePosition(pos.code);
     }
@@ -1,4 +1,5 @@
 #include "../../include/RiskManager.h"
+#include "../../include/Clock.h"
 #include <algorithm>
 #include <ctime>
 #include <iomanip>
@@ -40,7 +41,7 @@ bool RiskManager::canOpenPosition(const std::string& code, double price, int qua
     std::lock_guard<std::mutex> lock(mtx);
 
     // 일일 손실 한도 체크
-    if (isDailyLossLimitReached()) {
+    if (dailyLossReached()) {
         return false;
     }
 
@@ -187,7 +188,7 @@ void RiskManager::closePosition(const std::string& code, double closePrice, int
     }
 
     // 자산 업데이트
-    currentEquity = config.dailyBudget + realizedPnL + getUnrealizedPnL();
+    currentEquity = config.dailyBudget + realizedPnL + sumUnrealizedPnL();
     peakEquity = (std::max)(peakEquity, currentEquity);
 }
 
@@ -216,6 +217,10 @@ double RiskManager::getRealizedPnL() const {
 
 double RiskManager::getUnrealizedPnL() const {
     std::lock_guard<std::mutex> lock(mtx);
+    return sumUnrealizedPnL();
+}
+
+double RiskManager::sumUnrealizedPnL() const {
     double unrealized = 0.0;
     for (const auto& pos : positions) {
         unrealized += pos.second.unrealizedPnL;
@@ -228,8 +233,12 @@ double RiskManager::getTotalPnL() const {
 }
 
 bool RiskManager::isDailyLossLimitReached() const {
-    double totalPnL = getTotalPnL();
-    return totalPnL <= -config.getMaxDailyLoss();
+    std::lock_guard<std::mutex> lock(mtx);
+    return dailyLossReached();
+}
+
+bool RiskManager::dailyLossReached() const {
+    return realizedPnL + sumUnrealizedPnL() <= -config.getMaxDailyLoss();
 }
 
 bool RiskManager::shouldStopLoss(const std::string& code) const {
@@ -345,26 +354,13 @@ double RiskManager::calculateTax(double amount) const {
 }
 
 bool RiskManager::isMarketOpen() const {
-    auto now = std::chrono::system_clock::now();
-    std::time_t t = std::chrono::system_clock::to_time_t(now);
-    std::tm* tm = std::localtime(&t);
-
-    // 주말 체크
-    if (tm->tm_wday == 0 || tm->tm_wday == 6) return false;
-
-    // 장 시간: 09:00 ~ 15:30
-    int minutes = tm->tm_hour * 60 + tm->tm_min;
-    return minutes >= 540 && minutes <= 930;  // 9:00 ~ 15:30
+    // 평일 09:00 ~ 15:30
+    return currentClock().session().isMarketHours();
 }
 
 bool RiskManager::isNearMarketClose() const {
-    auto now = std::chrono::system_clock::now();
-    std::time_t t = std::chrono::system_clock::to_time_t(now);
-    std::tm* tm = std::localtime(&t);
-
     // 14:30 이후 (데이트레이딩 강제청산 시간)
-    int minutes = tm->tm_hour * 60 + tm->tm_min;
-    return minutes >= 870;  // 14:30
+    return currentClock().session().minuteOfDay >= SessionTime::TIME_STOP;
 }
 
 } // namespace yuanta
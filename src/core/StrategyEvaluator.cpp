@@ -0,0 +1,123 @@
+#include "../../include/StrategyEvaluator.h"
+#include <iostream>
+
+namespace yuanta {
+
+StrategyEvaluator::StrategyEvaluator()
+    : pending(SymbolRegistry::MAX_SYMBOLS, 0) {}
+
+StrategyEvaluator::~StrategyEvaluator() {
+    stop();
+}
+
+void StrategyEvaluator::setHandler(EvaluateHandler handler) {
+    this->handler = handler;
+}
+
+void StrategyEvaluator::start() {
+    if (running) return;
+
+    running = true;
+    evaluationThread = std::thread(&StrategyEvaluator::processLoop, this);
+    std::cout << "StrategyEvaluator started" << std::endl;
+}
+
+void StrategyEvaluator::stop() {
+    if (!running) return;
+
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        running = false;
+    }
+    cv.notify_all();
+
+    if (evaluationThread.joinable()) {
+        evaluationThread.join();
+    }
+
+    // 평가하지 못한 대기열은 버리고 대기 플래그도 해제 (재시작 후 알림이 합쳐져 사라지지 않도록)
+    size_t dropped = 0;
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        dropped = queue.size();
+        for (SymbolId id : queue) {
+            pending[id] = 0;
+        }
+        queue.clear();
+    }
+
+    std::cout << "StrategyEvaluator stopped";
+    if (dropped > 0) std::cout << " (" << dropped << " pending dropped)";
+    std::cout << std::endl;
+}
+
+bool StrategyEvaluator::isRunning() const {
+    return running;
+}
+
+void StrategyEvaluator::notify(SymbolId id) {
+    if (id >= pending.size()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+
+        // 이미 대기 중이면 합침
+        if (pending[id]) {
+            coalescedCount++;
+            return;
+        }
+        pending[id] = 1;
+        queue.push_back(id);
+    }
+    cv.notify_one();
+}
+
+void StrategyEvaluator::notify(const std::string& code) {
+    notify(SymbolRegistry::instance().find(code));
+}
+
+size_t StrategyEvaluator::getPendingCount() const {
+    std::lock_guard<std::mutex> lock(queueMutex);
+    return queue.size();
+}
+
+long long StrategyEvaluator::getEvaluationCount() const {
+    return evaluationCount;
+}
+
+long long StrategyEvaluator::getCoalescedCount() const {
+    return coalescedCount;
+}
+
+void StrategyEvaluator::processLoop() {
+    while (true) {
+        SymbolId id;
+
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            cv.wait(lock, [this] { return !queue.empty() || !running; });
+
+            if (!running) break;
+
+            id = queue.front();
+            queue.pop_front();
+
+            // 평가 중 들어오는 알림은 다시 대기열에 쌓이도록 먼저 해제
+            pending[id] = 0;
+        }
+
+        const std::string& code = SymbolRegistry::instance().code(id);
+
+        if (handler) {
+            try {
+                handler(code);
+            } catch (const std::exception& e) {
+                std::cerr << "Strategy evaluation error [" << code << "]: "
+                          << e.what() << std::endl;
+            }
+        }
+        evaluationCount++;
+    }
+}
+
+} // namespace yuanta
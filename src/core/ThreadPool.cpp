@@ -0,0 +1,107 @@
+#include "../../include/ThreadPool.h"
+#include <algorithm>
+
+namespace yuanta {
+
+namespace {
+// 현재 스레드가 속한 풀과 작업자 번호 (작업 안에서 제출한 작업을 자기 대기열에 넣기 위함)
+thread_local const ThreadPool* currentPool = nullptr;
+thread_local size_t currentWorker = 0;
+}
+
+ThreadPool::ThreadPool(size_t threadCount) {
+    if (threadCount == 0) {
+        threadCount = (std::max)(1u, std::thread::hardware_concurrency());
+    }
+
+    for (size_t i = 0; i < threadCount; ++i) {
+        queues.push_back(std::make_unique<WorkerQueue>());
+    }
+    for (size_t i = 0; i < threadCount; ++i) {
+        workers.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(waitMutex);
+        stopping = true;
+    }
+    cv.notify_all();
+
+    for (auto& worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+void ThreadPool::enqueue(Task task) {
+    size_t index = (currentPool == this) ?
+        currentWorker : nextQueue.fetch_add(1) % queues.size();
+
+    // 대기열에 넣기 전에 먼저 세어 pendingTasks가 음수로 내려가지 않게 함
+    pendingTasks++;
+    {
+        std::lock_guard<std::mutex> lock(queues[index]->mtx);
+        queues[index]->tasks.push_back(std::move(task));
+    }
+
+    // 대기 판단과 알림 사이에 끼어들지 않도록 waitMutex를 거쳐 깨움
+    {
+        std::lock_guard<std::mutex> lock(waitMutex);
+    }
+    cv.notify_one();
+}
+
+bool ThreadPool::popTask(size_t index, Task& task) {
+    // 자기 대기열: 가장 최근 작업 (캐시에 남아 있을 가능성이 높음)
+    {
+        WorkerQueue& own = *queues[index];
+        std::lock_guard<std::mutex> lock(own.mtx);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            pendingTasks--;
+            return true;
+        }
+    }
+
+    // 다른 작업자 대기열: 가장 오래된 작업을 훔침
+    for (size_t k = 1; k < queues.size(); ++k) {
+        WorkerQueue& victim = *queues[(index + k) % queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mtx);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            pendingTasks--;
+            stealCount++;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::workerLoop(size_t index) {
+    currentPool = this;
+    currentWorker = index;
+
+    while (true) {
+        Task task;
+        if (popTask(index, task)) {
+            task();
+            executedCount++;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(waitMutex);
+        cv.wait(lock, [this] { return stopping || pendingTasks > 0; });
+
+        // 종료 시에도 남은 작업은 모두 처리 (제출된 future가 끊기지 않도록)
+        if (stopping && pendingTasks == 0) break;
+    }
+
+    currentPool = nullptr;
+}
+
+} // namespace yuanta
@@ -0,0 +1,220 @@
+#include "../../include/BarFile.h"
+#include <iostream>
+#include <cstring>
+
+namespace yuanta {
+
+static const char BAR_FILE_MAGIC[4] = {'Y', 'B', 'A', 'R'};
+static const size_t BAR_COLUMN_COUNT = 6;
+
+// ============================================================================
+// BarSeriesView
+// ============================================================================
+
+OHLCV BarSeriesView::at(size_t i) const {
+    OHLCV bar;
+    bar.timestamp = timestamp[i];
+    bar.open = open[i];
+    bar.high = high[i];
+    bar.low = low[i];
+    bar.close = close[i];
+    bar.volume = volume[i];
+    return bar;
+}
+
+void BarSeriesView::appendTo(std::vector<OHLCV>& out, size_t n) const {
+    size_t start = n < count ? count - n : 0;
+    out.reserve(out.size() + (count - start));
+    for (size_t i = start; i < count; ++i) {
+        out.push_back(at(i));
+    }
+}
+
+// ============================================================================
+// BarFileReader
+// ============================================================================
+
+bool BarFileReader::open(const std::string& path) {
+    close();
+
+    if (!file.open(path)) {
+        return false;
+    }
+
+    const char* base = file.data();
+    size_t size = file.size();
+
+    if (size < sizeof(BarFileHeader)) {
+        std::cerr << "Invalid bar file (too small): " << path << std::endl;
+        close();
+        return false;
+    }
+
+    const BarFileHeader* h = reinterpret_cast<const BarFileHeader*>(base);
+    if (std::memcmp(h->magic, BAR_FILE_MAGIC, 4) != 0 || h->version != BAR_FILE_VERSION) {
+        std::cerr << "Invalid bar file header: " << path << std::endl;
+        close();
+        return false;
+    }
+
+    uint64_t indexBytes = static_cast<uint64_t>(h->symbolCount) * sizeof(BarFileIndexEntry);
+    if (h->indexOffset > size || indexBytes > size - h->indexOffset) {
+        std::cerr << "Invalid bar file index: " << path << std::endl;
+        close();
+        return false;
+    }
+
+    // 컬럼 범위 검증 (이후 접근은 검증 없이 수행)
+    const BarFileIndexEntry* entries =
+        reinterpret_cast<const BarFileIndexEntry*>(base + h->indexOffset);
+    for (uint32_t i = 0; i < h->symbolCount; ++i) {
+        uint64_t columnBytes = entries[i].barCount * sizeof(double);
+        if (entries[i].dataOffset % sizeof(double) != 0 ||
+            entries[i].barCount > size / (sizeof(double) * BAR_COLUMN_COUNT) ||
+            entries[i].dataOffset > size ||
+            columnBytes * BAR_COLUMN_COUNT > size - entries[i].dataOffset) {
+            std::cerr << "Invalid bar file series #" << i << ": " << path << std::endl;
+            close();
+            return false;
+        }
+    }
+
+    header = h;
+    index = entries;
+    return true;
+}
+
+void BarFileReader::close() {
+    header = nullptr;
+    index = nullptr;
+    file.close();
+}
+
+std::vector<std::string> BarFileReader::symbols() const {
+    std::vector<std::string> result;
+    for (size_t i = 0; i < symbolCount(); ++i) {
+        result.emplace_back(index[i].code, strnlen(index[i].code, sizeof(index[i].code)));
+    }
+    return result;
+}
+
+bool BarFileReader::series(size_t i, BarSeriesView& out) const {
+    if (!header || i >= header->symbolCount) return false;
+
+    const BarFileIndexEntry& entry = index[i];
+    const char* columns = file.data() + entry.dataOffset;
+    size_t n = static_cast<size_t>(entry.barCount);
+
+    out.code.assign(entry.code, strnlen(entry.code, sizeof(entry.code)));
+    out.count = n;
+    out.timestamp = reinterpret_cast<const long long*>(columns);
+    out.open = reinterpret_cast<const double*>(columns + n * 8);
+    out.high = reinterpret_cast<const double*>(columns + n * 16);
+    out.low = reinterpret_cast<const double*>(columns + n * 24);
+    out.close = reinterpret_cast<const double*>(columns + n * 32);
+    out.volume = reinterpret_cast<const long long*>(columns + n * 40);
+    return true;
+}
+
+bool BarFileReader::find(const std::string& code, BarSeriesView& out) const {
+    if (!header || code.size() >= sizeof(index[0].code)) return false;
+
+    for (size_t i = 0; i < header->symbolCount; ++i) {
+        if (std::strncmp(index[i].code, code.c_str(), sizeof(index[i].code)) == 0) {
+            return series(i, out);
+        }
+    }
+    return false;
+}
+
+// ============================================================================
+// BarFileWriter
+// ============================================================================
+
+BarFileWriter::~BarFileWriter() {
+    if (out.is_open()) {
+        finish();
+    }
+}
+
+bool BarFileWriter::open(const std::string& path) {
+    out.open(path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        std::cerr << "Failed to create file: " << path << std::endl;
+        return false;
+    }
+
+    outputPath = path;
+    entries.clear();
+    totalBars = 0;
+
+    // 헤더 자리 확보 (finish에서 다시 기록)
+    BarFileHeader header = {};
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    offset = sizeof(header);
+    return true;
+}
+
+template <typename T, typename F>
+void BarFileWriter::writeColumn(const std::vector<OHLCV>& candles, F field) {
+    std::vector<T> column;
+    column.reserve(candles.size());
+    for (const auto& c : candles) {
+        column.push_back(static_cast<T>(field(c)));
+    }
+    out.write(reinterpret_cast<const char*>(column.data()), column.size() * sizeof(T));
+}
+
+bool BarFileWriter::addSeries(const std::string& code, const std::vector<OHLCV>& candles) {
+    if (!out.is_open()) return false;
+
+    BarFileIndexEntry entry = {};
+    if (code.size() >= sizeof(entry.code)) {
+        std::cerr << "Symbol code too long for bar file: " << code << std::endl;
+        return false;
+    }
+    std::memcpy(entry.code, code.data(), code.size());
+    entry.barCount = candles.size();
+    entry.dataOffset = offset;
+    entry.firstTimestamp = candles.empty() ? 0 : candles.front().timestamp;
+    entry.lastTimestamp = candles.empty() ? 0 : candles.back().timestamp;
+
+    writeColumn<int64_t>(candles, [](const OHLCV& c) { return c.timestamp; });
+    writeColumn<double>(candles, [](const OHLCV& c) { return c.open; });
+    writeColumn<double>(candles, [](const OHLCV& c) { return c.high; });
+    writeColumn<double>(candles, [](const OHLCV& c) { return c.low; });
+    writeColumn<double>(candles, [](const OHLCV& c) { return c.close; });
+    writeColumn<int64_t>(candles, [](const OHLCV& c) { return c.volume; });
+
+    offset += candles.size() * sizeof(double) * BAR_COLUMN_COUNT;
+    totalBars += candles.size();
+    entries.push_back(entry);
+
+    return out.good();
+}
+
+bool BarFileWriter::finish() {
+    if (!out.is_open()) return false;
+
+    BarFileHeader header = {};
+    std::memcpy(header.magic, BAR_FILE_MAGIC, 4);
+    header.version = BAR_FILE_VERSION;
+    header.symbolCount = static_cast<uint32_t>(entries.size());
+    header.indexOffset = offset;
+    header.totalBars = totalBars;
+
+    out.write(reinterpret_cast<const char*>(entries.data()),
+              entries.size() * sizeof(BarFileIndexEntry));
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    bool ok = out.good();
+    out.close();
+
+    if (!ok) {
+        std::cerr << "Failed to write bar file: " << outputPath << std::endl;
+    }
+    return ok;
+}
+
+} // namespace yuanta
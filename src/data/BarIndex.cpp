@@ -0,0 +1,67 @@
+#include "../../include/BarIndex.h"
+#include <algorithm>
+
+namespace yuanta {
+
+size_t lowerBoundTime(Span<OHLCV> bars, long long timestamp) {
+    auto it = std::lower_bound(bars.begin(), bars.end(), timestamp,
+        [](const OHLCV& bar, long long t) { return bar.timestamp < t; });
+    return static_cast<size_t>(it - bars.begin());
+}
+
+size_t upperBoundTime(Span<OHLCV> bars, long long timestamp) {
+    auto it = std::upper_bound(bars.begin(), bars.end(), timestamp,
+        [](long long t, const OHLCV& bar) { return t < bar.timestamp; });
+    return static_cast<size_t>(it - bars.begin());
+}
+
+Span<OHLCV> barsBetween(Span<OHLCV> bars, long long startTime, long long endTime) {
+    if (endTime < startTime) return Span<OHLCV>();
+
+    size_t first = lowerBoundTime(bars, startTime);
+    size_t last = upperBoundTime(bars, endTime);
+    return bars.subspan(first, last > first ? last - first : 0);
+}
+
+// ============================================================================
+// DayIndex
+// ============================================================================
+
+long long DayIndex::dayStart(long long timestamp) {
+    long long local = timestamp + KST_OFFSET_MS;
+    long long day = local / DAY_MS;
+    if (local % DAY_MS < 0) day--;   // 1970년 이전
+    return day * DAY_MS - KST_OFFSET_MS;
+}
+
+void DayIndex::build(Span<OHLCV> source) {
+    bars = source;
+    days.clear();
+
+    size_t i = 0;
+    while (i < bars.size()) {
+        long long date = dayStart(bars[i].timestamp);
+
+        // 다음 날 0시 이상인 첫 봉까지가 하루
+        size_t end = i + lowerBoundTime(bars.subspan(i, bars.size() - i), date + DAY_MS);
+        days.push_back(Day{date, i, end});
+        i = end;
+    }
+}
+
+Span<OHLCV> DayIndex::dayRange(size_t first, size_t count) const {
+    if (first >= days.size() || count == 0) return Span<OHLCV>();
+
+    size_t last = (std::min)(first + count, days.size()) - 1;
+    return bars.subspan(days[first].begin, days[last].end - days[first].begin);
+}
+
+size_t DayIndex::findDay(long long timestamp) const {
+    long long date = dayStart(timestamp);
+    auto it = std::lower_bound(days.begin(), days.end(), date,
+        [](const Day& d, long long t) { return d.date < t; });
+    if (it == days.end() || it->date != date) return npos;
+    return static_cast<size_t>(it - days.begin());
+}
+
+} // namespace yuanta
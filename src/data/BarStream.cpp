@@ -0,0 +1,89 @@
+#include "../../include/BarStream.h"
+
+namespace yuanta {
+
+void MergedBarStream::reserve(size_t seriesCount) {
+    series.reserve(seriesCount);
+    cursors.reserve(seriesCount);
+    heap.reserve(seriesCount);
+}
+
+size_t MergedBarStream::addSeries(Span<OHLCV> bars, size_t start) {
+    size_t id = series.size();
+    series.push_back(bars);
+    cursors.push_back(start);
+
+    if (start < bars.size()) {
+        heap.push_back(HeapEntry{bars[start].timestamp, static_cast<uint32_t>(id)});
+        siftUp(heap.size() - 1);
+    }
+    return id;
+}
+
+bool MergedBarStream::next(Event& out) {
+    if (heap.empty()) return false;
+
+    size_t id = heap.front().series;
+    size_t index = cursors[id]++;
+
+    out.series = id;
+    out.index = index;
+    out.bar = &series[id][index];
+
+    // 같은 시리즈의 다음 봉으로 루트를 교체 (pop + push 대신 한 번의 sift-down)
+    if (index + 1 < series[id].size()) {
+        heap.front().time = series[id][index + 1].timestamp;
+    } else {
+        heap.front() = heap.back();
+        heap.pop_back();
+    }
+    if (!heap.empty()) {
+        siftDown(0);
+    }
+    return true;
+}
+
+bool MergedBarStream::peekTime(long long& timestamp) const {
+    if (heap.empty()) return false;
+    timestamp = heap.front().time;
+    return true;
+}
+
+size_t MergedBarStream::remaining() const {
+    size_t count = 0;
+    for (size_t i = 0; i < series.size(); ++i) {
+        if (cursors[i] < series[i].size()) {
+            count += series[i].size() - cursors[i];
+        }
+    }
+    return count;
+}
+
+void MergedBarStream::siftUp(size_t pos) {
+    HeapEntry entry = heap[pos];
+    while (pos > 0) {
+        size_t parent = (pos - 1) / 2;
+        if (!entry.before(heap[parent])) break;
+        heap[pos] = heap[parent];
+        pos = parent;
+    }
+    heap[pos] = entry;
+}
+
+void MergedBarStream::siftDown(size_t pos) {
+    HeapEntry entry = heap[pos];
+    size_t count = heap.size();
+    while (true) {
+        size_t child = pos * 2 + 1;
+        if (child >= count) break;
+        if (child + 1 < count && heap[child + 1].before(heap[child])) {
+            child++;
+        }
+        if (!heap[child].before(entry)) break;
+        heap[pos] = heap[child];
+        pos = child;
+    }
+    heap[pos] = entry;
+}
+
+} // namespace yuanta
@@ -0,0 +1,147 @@
+#include "../../include/CSVBarParser.h"
+#include "../../include/MappedFile.h"
+#include <iostream>
+#include <cstring>
+#include <cstdlib>
+#include <charconv>
+
+namespace yuanta {
+
+namespace {
+
+bool parseField(const char* first, const char* last, long long& value) {
+    if (first == last) return false;
+    if (*first == '+') ++first;
+    auto res = std::from_chars(first, last, value);
+    return res.ec == std::errc() && res.ptr == last;
+}
+
+bool parseField(const char* first, const char* last, double& value) {
+    if (first == last) return false;
+    if (*first == '+') ++first;
+
+#if defined(__cpp_lib_to_chars) || defined(_MSC_VER)
+    auto res = std::from_chars(first, last, value);
+    return res.ec == std::errc() && res.ptr == last;
+#else
+    // 부동소수점 from_chars가 없는 표준 라이브러리용
+    char buffer[64];
+    size_t len = static_cast<size_t>(last - first);
+    if (len >= sizeof(buffer)) return false;
+    std::memcpy(buffer, first, len);
+    buffer[len] = '\0';
+    char* endPtr = nullptr;
+    value = std::strtod(buffer, &endPtr);
+    return endPtr == buffer + len;
+#endif
+}
+
+// 한 줄 파싱 (앞 6개 필드, 나머지 열은 무시)
+bool parseLine(const char* p, const char* end, OHLCV& bar) {
+    const char* fields[7];
+    int count = 0;
+
+    fields[count++] = p;
+    while (count < 7) {
+        const char* comma = static_cast<const char*>(std::memchr(p, ',', end - p));
+        if (!comma) break;
+        p = comma + 1;
+        fields[count++] = p;
+    }
+    if (count < 6) return false;
+
+    // 필드 i의 끝 = 다음 필드 시작 - 1 (마지막 필드는 줄 끝)
+    auto fieldEnd = [&](int i) { return (i + 1 < count) ? fields[i + 1] - 1 : end; };
+
+    return parseField(fields[0], fieldEnd(0), bar.timestamp) &&
+           parseField(fields[1], fieldEnd(1), bar.open) &&
+           parseField(fields[2], fieldEnd(2), bar.high) &&
+           parseField(fields[3], fieldEnd(3), bar.low) &&
+           parseField(fields[4], fieldEnd(4), bar.close) &&
+           parseField(fields[5], fieldEnd(5), bar.volume);
+}
+
+} // namespace
+
+void CSVBarParser::parseBuffer(const char* begin, const char* end,
+                               std::vector<OHLCV>& candles,
+                               CSVParseResult& result) {
+    result.bytes += static_cast<size_t>(end - begin);
+
+    // 대략적인 행 수로 미리 확보 (한 행 약 48바이트)
+    candles.reserve(candles.size() + static_cast<size_t>(end - begin) / 48);
+
+    const char* p = begin;
+    size_t lineNo = 0;
+
+    // UTF-8 BOM
+    if (end - p >= 3 && std::memcmp(p, "\xEF\xBB\xBF", 3) == 0) {
+        p += 3;
+    }
+
+    while (p < end) {
+        const char* newline = static_cast<const char*>(std::memchr(p, '\n', end - p));
+        const char* lineEnd = newline ? newline : end;
+        const char* next = newline ? newline + 1 : end;
+        lineNo++;
+
+        if (lineEnd > p && lineEnd[-1] == '\r') {
+            --lineEnd;
+        }
+
+        // 빈 줄
+        if (lineEnd == p) {
+            p = next;
+            continue;
+        }
+
+        // 헤더 (첫 줄이 숫자로 시작하지 않음)
+        if (lineNo == 1 && !((*p >= '0' && *p <= '9') || *p == '-' || *p == '+')) {
+            p = next;
+            continue;
+        }
+
+        OHLCV bar;
+        if (parseLine(p, lineEnd, bar)) {
+            candles.push_back(bar);
+            result.rows++;
+        } else {
+            result.malformed++;
+            if (result.malformedLines.size() < CSVParseResult::MAX_REPORTED_LINES) {
+                result.malformedLines.push_back(lineNo);
+            }
+        }
+
+        p = next;
+    }
+}
+
+bool CSVBarParser::parseFile(const std::string& filepath,
+                             std::vector<OHLCV>& candles,
+                             CSVParseResult* result) {
+    MappedFile file;
+    if (!file.open(filepath)) {
+        return false;
+    }
+
+    CSVParseResult local;
+    CSVParseResult& res = result ? *result : local;
+
+    parseBuffer(file.data(), file.data() + file.size(), candles, res);
+
+    if (res.malformed > 0) {
+        std::cerr << "Skipped " << res.malformed << " malformed row(s) in " << filepath
+                  << " (line";
+        for (size_t line : res.malformedLines) {
+            std::cerr << " " << line;
+        }
+        if (res.malformed > res.malformedLines.size()) {
+            std::cerr << " ...";
+        }
+        std::cerr << ")" << std::endl;
+    }
+
+    return true;
+}
+
+} // namespace yuanta
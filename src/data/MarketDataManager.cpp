@@ -1,4 +1,7 @@
 #include "../../include/MarketDataManager.h"
+#include "../../include/CSVBarParser.h"
+#include "../../include/BarIndex.h"
+#include "../../include/Clock.h"
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -6,6 +9,7 @@
 #include <chrono>
 #include <iomanip>
 #include <algorithm>
+#include <cstring>
 
 namespace yuanta {
 
@@ -13,7 +17,10 @@ namespace yuanta {
 // MarketDataManager
 // ============================================================================
 
-MarketDataManager::MarketDataManager() {}
+MarketDataManager::MarketDataManager()
+    : stocks(SymbolRegistry::MAX_SYMBOLS),
+      quoteSnapshots(new SeqLock<QuoteSnapshot>[SymbolRegistry::MAX_SYMBOLS]),
+      orderbookSnapshots(new SeqLock<OrderbookSnapshot>[SymbolRegistry::MAX_SYMBOLS]) {}
 
 MarketDataManager::~MarketDataManager() {
     stopRealtime();
@@ -23,28 +30,142 @@ void MarketDataManager::setAPI(YuantaAPI* api) {
     this->api = api;
 }
 
+std::mutex& MarketDataManager::shardMutex(SymbolId id) const {
+    return shards[id % SHARD_COUNT].mtx;
+}
+
+MarketDataManager::StockData* MarketDataManager::stockFor(SymbolId id) const {
+    return id < stocks.size() ? stocks[id].get() : nullptr;
+}
+
+void MarketDataManager::resetSnapshots(SymbolId id) {
+    quoteSnapshots[id].store(QuoteSnapshot());
+    orderbookSnapshots[id].store(OrderbookSnapshot());
+}
+
 void MarketDataManager::addWatchlist(const std::string& code) {
-    std::lock_guard<std::mutex> lock(dataMutex);
+    std::lock_guard<std::mutex> lock(watchlistMutex);
 
     auto it = std::find(watchlist.begin(), watchlist.end(), code);
     if (it == watchlist.end()) {
+        SymbolId id = SymbolRegistry::instance().intern(code);
+        if (id == INVALID_SYMBOL_ID) return;
+
         watchlist.push_back(code);
-        stockData[code] = StockData();
+
+        std::vector<int> timeframes;
+        {
+            std::lock_guard<std::mutex> tfLock(timeframeMutex);
+            timeframes = defaultTimeframes;
+        }
+        auto data = createStockData(timeframes);
+
+        std::lock_guard<std::mutex> shardLock(shardMutex(id));
+        stocks[id] = std::move(data);
     }
 }
 
 void MarketDataManager::removeWatchlist(const std::string& code) {
-    std::lock_guard<std::mutex> lock(dataMutex);
+    std::lock_guard<std::mutex> lock(watchlistMutex);
 
     auto it = std::find(watchlist.begin(), watchlist.end(), code);
     if (it != watchlist.end()) {
         watchlist.erase(it);
-        stockData.erase(code);
+
+        SymbolId id = SymbolRegistry::instance().find(code);
+        if (id == INVALID_SYMBOL_ID) return;
+
+        std::lock_guard<std::mutex> shardLock(shardMutex(id));
+        stocks[id].reset();
+        resetSnapshots(id);
     }
 }
 
+bool MarketDataManager::isValidTimeframe(int minutes) {
+    return minutes >= 1 && TIMEFRAME_DAILY % minutes == 0;
+}
+
+void MarketDataManager::addSeries(StockData& data, int minutes) {
+    auto it = data.series.begin();
+    while (it != data.series.end() && it->minutes < minutes) {
+        ++it;
+    }
+    if (it != data.series.end() && it->minutes == minutes) return;
+    if (data.series.size() >= MAX_TIMEFRAMES) return;
+
+    size_t capacity = (minutes == TIMEFRAME_DAILY) ? DAILY_CANDLE_CAPACITY : MINUTE_CANDLE_CAPACITY;
+    data.series.insert(it, CandleSeries(minutes, capacity));
+}
+
+std::unique_ptr<MarketDataManager::StockData> MarketDataManager::createStockData(
+    const std::vector<int>& minutesList) const {
+
+    std::unique_ptr<StockData> data(new StockData());
+
+    // 1분봉(집계 기준)과 일봉은 항상 유지
+    addSeries(*data, 1);
+    addSeries(*data, TIMEFRAME_DAILY);
+    for (int minutes : minutesList) {
+        addSeries(*data, minutes);
+    }
+    return data;
+}
+
+bool MarketDataManager::setDefaultTimeframes(const std::vector<int>& minutesList) {
+    for (int minutes : minutesList) {
+        if (!isValidTimeframe(minutes)) {
+            std::cerr << "Invalid timeframe: " << minutes << " minutes" << std::endl;
+            return false;
+        }
+    }
+    if (minutesList.size() + 2 > MAX_TIMEFRAMES) {
+        std::cerr << "Too many timeframes (max " << MAX_TIMEFRAMES << ")" << std::endl;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(timeframeMutex);
+    defaultTimeframes = minutesList;
+    return true;
+}
+
+bool MarketDataManager::registerTimeframe(const std::string& code, int minutes) {
+    if (!isValidTimeframe(minutes)) {
+        std::cerr << "Invalid timeframe: " << minutes << " minutes" << std::endl;
+        return false;
+    }
+
+    SymbolId id = SymbolRegistry::instance().find(code);
+    if (id == INVALID_SYMBOL_ID) return false;
+
+    std::lock_guard<std::mutex> lock(shardMutex(id));
+
+    StockData* data = stockFor(id);
+    if (!data) return false;
+
+    // 등록 이후 완성되는 1분봉부터 누적된다
+    addSeries(*data, minutes);
+    return minuteSeries(*data, minutes) != nullptr;
+}
+
+std::vector<int> MarketDataManager::getTimeframes(const std::string& code) const {
+    std::vector<int> result;
+
+    SymbolId id = SymbolRegistry::instance().find(code);
+    if (id == INVALID_SYMBOL_ID) return result;
+
+    std::lock_guard<std::mutex> lock(shardMutex(id));
+
+    const StockData* data = stockFor(id);
+    if (!data) return result;
+
+    for (const auto& series : data->series) {
+        result.push_back(series.minutes);
+    }
+    return result;
+}
+
 std::vector<std::string> MarketDataManager::getWatchlist() const {
-    std::lock_guard<std::mutex> lock(dataMutex);
+    std::lock_guard<std::mutex> lock(watchlistMutex);
     return watchlist;
 }
 
@@ -52,7 +173,7 @@ bool MarketDataManager::startRealtime() {
     if (realtimeRunning) return true;
     if (!api) return false;
 
-    std::lock_guard<std::mutex> lock(dataMutex);
+    std::lock_guard<std::mutex> lock(watchlistMutex);
 
     // 각 종목 실시간 구독
     for (const auto& code : watchlist) {
@@ -60,12 +181,23 @@ bool MarketDataManager::startRealtime() {
         api->subscribeOrderbook(code);
     }
 
-    // 콜백 설정
+    // 콜백은 큐에 넣기만 하고 즉시 반환 (브로커 콜백 스레드를 막지 않음)
     api->setQuoteCallback([this](const QuoteData& quote) {
-        processQuote(quote);
+        enqueueQuote(quote);
+    });
+
+    // 호가도 큐에 넣기만 함 (샤드 락은 수신 스레드만 잡으므로 워밍업/분봉 집계와 경합 없음)
+    api->setOrderbookCallback([this](const OrderbookData& orderbook) {
+        enqueueOrderbook(orderbook);
     });
 
     realtimeRunning = true;
+    realtimeThread = std::thread(&MarketDataManager::ingestLoop, this);
+
+    if (api->isSimulationMode()) {
+        api->startSimulatedFeed();
+    }
+
     std::cout << "Realtime data started for " << watchlist.size() << " stocks" << std::endl;
 
     return true;
@@ -74,10 +206,18 @@ bool MarketDataManager::startRealtime() {
 void MarketDataManager::stopRealtime() {
     if (!realtimeRunning) return;
 
+    // 생산자(모의 피드)를 먼저 멈춘 뒤 수신 스레드 종료
+    if (api && api->isSimulationMode()) {
+        api->stopSimulatedFeed();
+    }
+
     realtimeRunning = false;
+    if (realtimeThread.joinable()) {
+        realtimeThread.join();
+    }
 
     if (api) {
-        std::lock_guard<std::mutex> lock(dataMutex);
+        std::lock_guard<std::mutex> lock(watchlistMutex);
         for (const auto& code : watchlist) {
             api->unsubscribeQuote(code);
         }
@@ -86,148 +226,416 @@ void MarketDataManager::stopRealtime() {
     std::cout << "Realtime data stopped" << std::endl;
 }
 
+bool MarketDataManager::enqueueQuote(const QuoteData& quote) {
+    IngestItem item;
+    item.quote = quote;
+    item.enqueuedAt = std::chrono::steady_clock::now();
+
+    if (!ingestQueue.tryPush(item)) {
+        ingestDropped++;
+        return false;
+    }
+    ingestEnqueued++;
+
+    size_t depth = ingestQueue.size();
+    if (depth > ingestMaxDepth.load(std::memory_order_relaxed)) {
+        ingestMaxDepth.store(depth, std::memory_order_relaxed);
+    }
+    return true;
+}
+
+bool MarketDataManager::enqueueOrderbook(const OrderbookData& orderbook) {
+    OrderbookItem item;
+    item.id = orderbook.symbolId;
+    if (item.id == INVALID_SYMBOL_ID) {
+        item.id = SymbolRegistry::instance().find(orderbook.code);
+        if (item.id == INVALID_SYMBOL_ID) return false;
+    }
+    item.snapshot = toSnapshot(orderbook);
+
+    if (!orderbookQueue.tryPush(item)) {
+        orderbookDropped++;
+        return false;
+    }
+    return true;
+}
+
+void MarketDataManager::ingestLoop() {
+    IngestItem item;
+    OrderbookItem book;
+    int idleCount = 0;
+
+    auto processItem = [this](const IngestItem& it) {
+        long long latencyUs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - it.enqueuedAt).count();
+
+        ingestTotalLatencyUs.fetch_add(latencyUs, std::memory_order_relaxed);
+        if (latencyUs > ingestMaxLatencyUs.load(std::memory_order_relaxed)) {
+            ingestMaxLatencyUs.store(latencyUs, std::memory_order_relaxed);
+        }
+
+        processQuote(it.quote);
+        ingestProcessed++;
+    };
+
+    while (realtimeRunning) {
+        bool worked = false;
+        if (ingestQueue.tryPop(item)) {
+            processItem(item);
+            worked = true;
+        }
+        if (orderbookQueue.tryPop(book)) {
+            storeOrderbook(book.id, book.snapshot);
+            worked = true;
+        }
+        if (worked) {
+            idleCount = 0;
+            continue;
+        }
+
+        // 유휴 시 잠깐 양보 후 짧게 대기
+        if (++idleCount < 64) {
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+    }
+
+    // 종료 전 남은 시세/호가 처리
+    while (ingestQueue.tryPop(item)) {
+        processItem(item);
+    }
+    while (orderbookQueue.tryPop(book)) {
+        storeOrderbook(book.id, book.snapshot);
+    }
+}
+
+MarketDataManager::IngestStats MarketDataManager::getIngestStats() const {
+    IngestStats stats;
+    stats.depth = ingestQueue.size();
+    stats.maxDepth = ingestMaxDepth.load();
+    stats.capacity = ingestQueue.capacity();
+    stats.enqueued = ingestEnqueued.load();
+    stats.processed = ingestProcessed.load();
+    stats.dropped = ingestDropped.load();
+    stats.orderbookDropped = orderbookDropped.load();
+    stats.maxLatencyUs = ingestMaxLatencyUs.load();
+    stats.avgLatencyUs = stats.processed > 0 ?
+        static_cast<double>(ingestTotalLatencyUs.load()) / stats.processed : 0.0;
+    return stats;
+}
+
 bool MarketDataManager::isRealtimeRunning() const {
     return realtimeRunning;
 }
 
 QuoteData MarketDataManager::getQuote(const std::string& code) const {
-    std::lock_guard<std::mutex> lock(dataMutex);
+    SymbolId id = SymbolRegistry::instance().find(code);
+    if (id == INVALID_SYMBOL_ID) {
+        QuoteData empty;
+        empty.code = code;
+        return empty;
+    }
+    return getQuote(id);
+}
 
-    auto it = stockData.find(code);
-    if (it != stockData.end()) {
-        return it->second.quote;
+QuoteData MarketDataManager::getQuote(SymbolId id) const {
+    QuoteData quote;
+    quote.code = SymbolRegistry::instance().code(id);
+    quote.symbolId = id;
+
+    QuoteSnapshot snap;
+    if (getQuoteSnapshot(id, snap)) {
+        quote.currentPrice = snap.currentPrice;
+        quote.openPrice = snap.openPrice;
+        quote.highPrice = snap.highPrice;
+        quote.lowPrice = snap.lowPrice;
+        quote.prevClose = snap.prevClose;
+        quote.volume = snap.volume;
+        quote.prevVolume = snap.prevVolume;
+        quote.changeRate = snap.changeRate;
+        quote.timestamp = snap.timestamp;
     }
+    return quote;
+}
+
+bool MarketDataManager::getQuoteSnapshot(SymbolId id, QuoteSnapshot& out) const {
+    if (id >= SymbolRegistry::MAX_SYMBOLS) return false;
+    return quoteSnapshots[id].load(out);
+}
 
-    QuoteData empty;
-    empty.code = code;
-    return empty;
+bool MarketDataManager::getOrderbookSnapshot(SymbolId id, OrderbookSnapshot& out) const {
+    if (id >= SymbolRegistry::MAX_SYMBOLS) return false;
+    return orderbookSnapshots[id].load(out);
+}
+
+const RingBuffer<OHLCV>* MarketDataManager::minuteSeries(const StockData& data,
+                                                         int minutes) const {
+    for (const auto& series : data.series) {
+        if (series.minutes == minutes) return &series.candles;
+    }
+    return nullptr;
 }
 
 std::vector<OHLCV> MarketDataManager::getMinuteCandles(const std::string& code,
                                                         int minutes, int count) const {
-    std::lock_guard<std::mutex> lock(dataMutex);
+    std::vector<OHLCV> result;
+    getMinuteCandles(code, minutes, count, result);
+    return result;
+}
 
-    auto it = stockData.find(code);
-    if (it == stockData.end()) {
-        return {};
-    }
+size_t MarketDataManager::getMinuteCandles(const std::string& code, int minutes, int count,
+                                           std::vector<OHLCV>& out) const {
+    return getMinuteCandles(SymbolRegistry::instance().find(code), minutes, count, out);
+}
 
-    const std::deque<OHLCV>* candleSource = nullptr;
-    if (minutes == 1) {
-        candleSource = &it->second.minute1Candles;
-    } else if (minutes == 5) {
-        candleSource = &it->second.minute5Candles;
-    } else {
-        return {};
-    }
+size_t MarketDataManager::getMinuteCandles(SymbolId id, int minutes, int count,
+                                           std::vector<OHLCV>& out) const {
+    out.clear();
+    if (count <= 0 || id == INVALID_SYMBOL_ID) return 0;
 
-    size_t actualCount = (std::min)(static_cast<size_t>(count), candleSource->size());
-    std::vector<OHLCV> result;
+    std::lock_guard<std::mutex> lock(shardMutex(id));
 
-    for (size_t i = candleSource->size() - actualCount; i < candleSource->size(); ++i) {
-        result.push_back((*candleSource)[i]);
-    }
+    const StockData* data = stockFor(id);
+    if (!data) return 0;
 
-    return result;
+    const RingBuffer<OHLCV>* series = minuteSeries(*data, minutes);
+    if (!series) return 0;
+
+    series->latest(static_cast<size_t>(count)).copyTo(out);
+    return out.size();
+}
+
+bool MarketDataManager::visitMinuteCandles(const std::string& code, int minutes, int count,
+                                           const CandleVisitor& visitor) const {
+    return visitMinuteCandles(SymbolRegistry::instance().find(code), minutes, count, visitor);
+}
+
+bool MarketDataManager::visitMinuteCandles(SymbolId id, int minutes, int count,
+                                           const CandleVisitor& visitor) const {
+    if (count <= 0 || id == INVALID_SYMBOL_ID) return false;
+
+    std::lock_guard<std::mutex> lock(shardMutex(id));
+
+    const StockData* data = stockFor(id);
+    if (!data) return false;
+
+    const RingBuffer<OHLCV>* series = minuteSeries(*data, minutes);
+    if (!series) return false;
+
+    visitor(series->latest(static_cast<size_t>(count)));
+    return true;
 }
 
 std::vector<OHLCV> MarketDataManager::getDailyCandles(const std::string& code,
                                                        int count) const {
-    std::lock_guard<std::mutex> lock(dataMutex);
+    std::vector<OHLCV> result;
+    if (count <= 0) return result;
 
-    auto it = stockData.find(code);
-    if (it == stockData.end()) {
-        return {};
-    }
+    SymbolId id = SymbolRegistry::instance().find(code);
+    if (id == INVALID_SYMBOL_ID) return result;
 
-    size_t actualCount = (std::min)(static_cast<size_t>(count),
-                                  it->second.dailyCandles.size());
-    std::vector<OHLCV> result;
+    std::lock_guard<std::mutex> lock(shardMutex(id));
 
-    for (size_t i = it->second.dailyCandles.size() - actualCount;
-         i < it->second.dailyCandles.size(); ++i) {
-        result.push_back(it->second.dailyCandles[i]);
-    }
+    const StockData* data = stockFor(id);
+    if (!data) return result;
 
+    const RingBuffer<OHLCV>* series = minuteSeries(*data, TIMEFRAME_DAILY);
+    if (series) {
+        series->latest(static_cast<size_t>(count)).copyTo(result);
+    }
     return result;
 }
 
 OrderbookData MarketDataManager::getOrderbook(const std::string& code) const {
-    std::lock_guard<std::mutex> lock(dataMutex);
+    SymbolId id = SymbolRegistry::instance().find(code);
+    if (id == INVALID_SYMBOL_ID) {
+        OrderbookData empty;
+        empty.code = code;
+        return empty;
+    }
+    return getOrderbook(id);
+}
+
+OrderbookData MarketDataManager::getOrderbook(SymbolId id) const {
+    OrderbookData orderbook;
+    orderbook.code = SymbolRegistry::instance().code(id);
+    orderbook.symbolId = id;
+
+    OrderbookSnapshot snap;
+    if (getOrderbookSnapshot(id, snap)) {
+        std::memcpy(orderbook.bidPrices, snap.bidPrices, sizeof(snap.bidPrices));
+        std::memcpy(orderbook.askPrices, snap.askPrices, sizeof(snap.askPrices));
+        std::memcpy(orderbook.bidVolumes, snap.bidVolumes, sizeof(snap.bidVolumes));
+        std::memcpy(orderbook.askVolumes, snap.askVolumes, sizeof(snap.askVolumes));
+    }
+    return orderbook;
+}
 
-    auto it = stockData.find(code);
-    if (it != stockData.end()) {
-        return it->second.orderbook;
+void MarketDataManager::processOrderbook(const OrderbookData& orderbook) {
+    SymbolId id = orderbook.symbolId;
+    if (id == INVALID_SYMBOL_ID) {
+        id = SymbolRegistry::instance().find(orderbook.code);
+        if (id == INVALID_SYMBOL_ID) return;
     }
 
-    OrderbookData empty;
-    empty.code = code;
-    return empty;
+    storeOrderbook(id, toSnapshot(orderbook));
+}
+
+MarketDataManager::OrderbookSnapshot MarketDataManager::toSnapshot(const OrderbookData& orderbook) {
+    OrderbookSnapshot snap;
+    std::memcpy(snap.bidPrices, orderbook.bidPrices, sizeof(snap.bidPrices));
+    std::memcpy(snap.askPrices, orderbook.askPrices, sizeof(snap.askPrices));
+    std::memcpy(snap.bidVolumes, orderbook.bidVolumes, sizeof(snap.bidVolumes));
+    std::memcpy(snap.askVolumes, orderbook.askVolumes, sizeof(snap.askVolumes));
+    return snap;
+}
+
+void MarketDataManager::storeOrderbook(SymbolId id, const OrderbookSnapshot& snapshot) {
+    if (id >= SymbolRegistry::MAX_SYMBOLS) return;
+
+    // 작성자 직렬화용 (읽기는 이 락을 잡지 않음)
+    std::lock_guard<std::mutex> lock(shardMutex(id));
+    if (!stockFor(id)) return;
+
+    orderbookSnapshots[id].store(snapshot);
 }
 
 void MarketDataManager::processQuote(const QuoteData& quote) {
-    std::lock_guard<std::mutex> lock(dataMutex);
+    CompletedCandles completed;
 
-    auto it = stockData.find(quote.code);
-    if (it == stockData.end()) return;
+    // 피드에서 ID를 붙여 주면 문자열 조회 없이 바로 인덱싱
+    SymbolId id = quote.symbolId;
+    if (id == INVALID_SYMBOL_ID) {
+        id = SymbolRegistry::instance().find(quote.code);
+        if (id == INVALID_SYMBOL_ID) return;
+    }
 
-    StockData& data = it->second;
-    data.quote = quote;
+    {
+        std::lock_guard<std::mutex> lock(shardMutex(id));
+
+        StockData* stock = stockFor(id);
+        if (!stock) return;
+
+        QuoteSnapshot snap;
+        snap.currentPrice = quote.currentPrice;
+        snap.openPrice = quote.openPrice;
+        snap.highPrice = quote.highPrice;
+        snap.lowPrice = quote.lowPrice;
+        snap.prevClose = quote.prevClose;
+        snap.volume = quote.volume;
+        snap.prevVolume = quote.prevVolume;
+        snap.changeRate = quote.changeRate;
+        snap.timestamp = quote.timestamp;
+        quoteSnapshots[id].store(snap);
+
+        aggregateQuote(*stock, quote, completed);
+    }
 
-    // 분봉 업데이트
-    updateCurrentCandle(data, quote, 1, data.currentCandle1, data.lastCandleTime1);
-    updateCurrentCandle(data, quote, 5, data.currentCandle5, data.lastCandleTime5);
+    // 콜백은 샤드 락 밖에서 호출
+    if (candleCallback) {
+        for (size_t i = 0; i < completed.count; ++i) {
+            candleCallback(quote.code, completed.minutes[i], completed.candles[i]);
+        }
+    }
 
-    // 콜백 호출
     if (quoteCallback) {
-        quoteCallback(quote.code, quote);
+        if (quote.symbolId == id) {
+            quoteCallback(quote.code, quote);
+        } else {
+            // ID 없이 들어온 시세는 ID를 붙여 전달
+            QuoteData stamped = quote;
+            stamped.symbolId = id;
+            quoteCallback(stamped.code, stamped);
+        }
     }
 }
 
-void MarketDataManager::updateCurrentCandle(StockData& data, const QuoteData& quote,
-                                             int minutes, OHLCV& currentCandle,
-                                             long long& lastTime) {
-    long long currentSlot = getMinuteSlot(quote.timestamp, minutes);
+void MarketDataManager::aggregateQuote(StockData& data, const QuoteData& quote,
+                                       CompletedCandles& completed) {
+    // 시세의 거래량은 당일 누적이므로 직전 시세와의 차이를 체결량으로 사용
+    // (누적이 줄어들면 새 거래일로 보고 그대로 사용, 첫 시세는 0)
+    long long tickVolume = 0;
+    if (data.lastCumVolume >= 0) {
+        tickVolume = (quote.volume >= data.lastCumVolume) ?
+            quote.volume - data.lastCumVolume : quote.volume;
+    }
+    data.lastCumVolume = quote.volume;
+
+    CandleSeries& minute = data.series[0];
+    long long slot = getMinuteSlot(quote.timestamp, 1);
+
+    // 1분봉 완성 → 상위 분봉에 누적
+    if (minute.slot != 0 && minute.slot != slot) {
+        OHLCV bar = minute.current;
+        bool hasTrades = bar.volume > 0;
+
+        closeCandle(minute, completed);
 
-    if (currentSlot != lastTime) {
-        // 이전 봉 완성
-        if (lastTime > 0 && currentCandle.volume > 0) {
-            std::deque<OHLCV>* candles = (minutes == 1) ?
-                &data.minute1Candles : &data.minute5Candles;
-            completeCandle(quote.code, minutes, currentCandle, *candles);
+        if (hasTrades) {
+            for (size_t i = 1; i < data.series.size(); ++i) {
+                rollUp(data.series[i], bar, completed);
+            }
         }
+    }
 
-        // 새 봉 시작
-        currentCandle.code = quote.code;
-        currentCandle.timestamp = currentSlot;
-        currentCandle.open = quote.currentPrice;
-        currentCandle.high = quote.currentPrice;
-        currentCandle.low = quote.currentPrice;
-        currentCandle.close = quote.currentPrice;
-        currentCandle.volume = 0;
+    // 새 시세가 다음 구간이면 상위 주기 봉도 완성
+    for (size_t i = 1; i < data.series.size(); ++i) {
+        CandleSeries& series = data.series[i];
+        if (series.slot != 0 && getMinuteSlot(quote.timestamp, series.minutes) != series.slot) {
+            closeCandle(series, completed);
+        }
+    }
 
-        lastTime = currentSlot;
+    // 1분봉 갱신
+    if (minute.slot != slot) {
+        minute.slot = slot;
+        minute.current.timestamp = slot;
+        minute.current.open = quote.currentPrice;
+        minute.current.high = quote.currentPrice;
+        minute.current.low = quote.currentPrice;
+        minute.current.close = quote.currentPrice;
+        minute.current.volume = tickVolume;
     } else {
-        // 현재 봉 업데이트
-        currentCandle.high = (std::max)(currentCandle.high, quote.currentPrice);
-        currentCandle.low = (std::min)(currentCandle.low, quote.currentPrice);
-        currentCandle.close = quote.currentPrice;
-        currentCandle.volume = quote.volume;
+        minute.current.high = (std::max)(minute.current.high, quote.currentPrice);
+        minute.current.low = (std::min)(minute.current.low, quote.currentPrice);
+        minute.current.close = quote.currentPrice;
+        minute.current.volume += tickVolume;
     }
 }
 
-void MarketDataManager::completeCandle(const std::string& code, int minutes,
-                                        const OHLCV& candle, std::deque<OHLCV>& candles) {
-    candles.push_back(candle);
+void MarketDataManager::closeCandle(CandleSeries& series, CompletedCandles& completed) {
+    // 체결이 없던 봉은 버림
+    if (series.slot != 0 && series.current.volume > 0) {
+        // 용량 초과 시 가장 오래된 봉을 덮어씀
+        series.candles.push(series.current);
 
-    // 최대 500개 유지
-    while (candles.size() > 500) {
-        candles.pop_front();
+        if (completed.count < MAX_TIMEFRAMES) {
+            completed.candles[completed.count] = series.current;
+            completed.minutes[completed.count] = series.minutes;
+            completed.count++;
+        }
     }
+    series.slot = 0;
+}
 
-    // 콜백 호출
-    if (candleCallback) {
-        candleCallback(code, minutes, candle);
+void MarketDataManager::rollUp(CandleSeries& series, const OHLCV& bar,
+                               CompletedCandles& completed) {
+    long long slot = getMinuteSlot(bar.timestamp, series.minutes);
+
+    if (series.slot != 0 && series.slot != slot) {
+        closeCandle(series, completed);
+    }
+
+    if (series.slot == 0) {
+        series.slot = slot;
+        series.current = bar;
+        series.current.timestamp = slot;
+    } else {
+        series.current.high = (std::max)(series.current.high, bar.high);
+        series.current.low = (std::min)(series.current.low, bar.low);
+        series.current.close = bar.close;
+        series.current.volume += bar.volume;
     }
 }
 
@@ -238,7 +646,7 @@ long long MarketDataManager::getMinuteSlot(long long timestamp, int minutes) con
 
 std::vector<OHLCV> MarketDataManager::getIntradayCandles(const std::string& code,
                                                           int minutes) const {
-    return getMinuteCandles(code, minutes, 500);
+    return getMinuteCandles(code, minutes, static_cast<int>(MINUTE_CANDLE_CAPACITY));
 }
 
 void MarketDataManager::setQuoteUpdateCallback(QuoteUpdateCallback callback) {
@@ -252,94 +660,249 @@ void MarketDataManager::setCandleCompleteCallback(CandleCompleteCallback callbac
 bool MarketDataManager::loadHistoricalData(const std::string& code, int days) {
     if (!api) return false;
 
-    std::lock_guard<std::mutex> lock(dataMutex);
+    SymbolId id = SymbolRegistry::instance().intern(code);
+    if (id == INVALID_SYMBOL_ID) return false;
+
+    HistoryLoadStats stats;
+    publishStockData(id, buildHistoryFromAPI(code, days, historyTimeframes(id), stats));
 
-    auto it = stockData.find(code);
-    if (it == stockData.end()) {
-        stockData[code] = StockData();
-        it = stockData.find(code);
+    std::cout << "Loaded " << stats.dailyCandles << " daily candles and "
+              << stats.minuteCandles << " minute candles for " << code << std::endl;
+
+    return true;
+}
+
+bool MarketDataManager::loadHistoricalData(const std::string& code,
+                                           const BarFileReader& minuteFile) {
+    BarSeriesView view;
+    if (!minuteFile.find(code, view)) {
+        return false;
     }
 
-    // 일봉 로드
+    SymbolId id = SymbolRegistry::instance().intern(code);
+    if (id == INVALID_SYMBOL_ID) return false;
+
+    HistoryLoadStats stats;
+    publishStockData(id, buildHistoryFromBarFile(view, historyTimeframes(id), stats));
+
+    std::cout << "Loaded " << stats.minuteCandles << " minute candles for " << code
+              << " from " << minuteFile.symbols().size() << "-symbol bar file" << std::endl;
+    return true;
+}
+
+size_t MarketDataManager::warmUpHistory(const std::vector<std::string>& codes, int days,
+                                        const BarFileReader* minuteFile,
+                                        size_t maxConcurrency) {
+    if (codes.empty()) return 0;
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    // 등록은 호출 스레드에서 미리 수행 (작업 스레드는 조회/디코딩/게시만)
+    std::vector<SymbolId> ids(codes.size());
+    for (size_t i = 0; i < codes.size(); ++i) {
+        ids[i] = SymbolRegistry::instance().intern(codes[i]);
+    }
+
+    std::vector<char> loaded(codes.size(), 0);
+    std::atomic<size_t> nextIndex{0};
+
+    // 작업 스레드는 다음 종목 번호를 원자적으로 가져가며 처리
+    // (동시 API 요청 수 = 작업 스레드 수)
+    auto worker = [&]() {
+        while (true) {
+            size_t i = nextIndex.fetch_add(1);
+            if (i >= codes.size()) break;
+            if (ids[i] == INVALID_SYMBOL_ID) continue;
+
+            HistoryLoadStats stats;
+            std::unique_ptr<StockData> data;
+            const std::vector<int> timeframes = historyTimeframes(ids[i]);
+
+            BarSeriesView view;
+            if (minuteFile && minuteFile->find(codes[i], view)) {
+                data = buildHistoryFromBarFile(view, timeframes, stats);
+            } else if (api) {
+                data = buildHistoryFromAPI(codes[i], days, timeframes, stats);
+            } else {
+                continue;
+            }
+
+            publishStockData(ids[i], std::move(data));
+            loaded[i] = 1;
+        }
+    };
+
+    size_t workerCount = (std::max)(size_t(1), (std::min)(maxConcurrency, codes.size()));
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount - 1);
+    for (size_t w = 1; w < workerCount; ++w) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto& t : workers) {
+        t.join();
+    }
+
+    size_t loadedCount = static_cast<size_t>(std::count(loaded.begin(), loaded.end(), 1));
+    auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - startTime).count();
+
+    std::cout << "Warmed up " << loadedCount << "/" << codes.size() << " symbols in "
+              << elapsedMs << "ms (" << workerCount << " workers)" << std::endl;
+
+    return loadedCount;
+}
+
+std::vector<int> MarketDataManager::historyTimeframes(SymbolId id) const {
+    std::vector<int> timeframes;
+    {
+        std::lock_guard<std::mutex> tfLock(timeframeMutex);
+        timeframes = defaultTimeframes;
+    }
+
+    // 종목별로 추가 등록된 주기도 유지
+    std::lock_guard<std::mutex> lock(shardMutex(id));
+    if (const StockData* data = stockFor(id)) {
+        for (const auto& series : data->series) {
+            timeframes.push_back(series.minutes);
+        }
+    }
+    return timeframes;
+}
+
+std::unique_ptr<MarketDataManager::StockData> MarketDataManager::buildHistoryFromAPI(
+    const std::string& code, int days, const std::vector<int>& timeframes,
+    HistoryLoadStats& stats) {
+
     auto dailyCandles = api->getDailyCandles(code, days);
+
+    int minuteCount = days * 390;  // 하루 390분 (9:00~15:30)
+    auto minuteCandles = api->getMinuteCandles(code, 1, minuteCount);
+
+    std::unique_ptr<StockData> data = createStockData(timeframes);
+
+    // 일봉은 가장 긴 주기이므로 항상 마지막 시리즈
+    RingBuffer<OHLCV>& daily = data->series.back().candles;
+
+    // 일봉 로드
     for (const auto& c : dailyCandles) {
         OHLCV ohlcv;
-        ohlcv.code = code;
         ohlcv.timestamp = c.timestamp;
         ohlcv.open = c.open;
         ohlcv.high = c.high;
         ohlcv.low = c.low;
         ohlcv.close = c.close;
         ohlcv.volume = c.volume;
-        it->second.dailyCandles.push_back(ohlcv);
+        daily.push(ohlcv);
     }
 
-    // 분봉 로드 (최근 20일치)
-    int minuteCount = days * 390;  // 하루 390분 (9:00~15:30)
-    auto minuteCandles = api->getMinuteCandles(code, 1, minuteCount);
+    // 분봉 로드 (상위 분봉도 1분봉에서 누적해 채움, 일봉은 위에서 로드)
+    CompletedCandles discarded;
     for (const auto& c : minuteCandles) {
         OHLCV ohlcv;
-        ohlcv.code = code;
         ohlcv.timestamp = c.timestamp;
         ohlcv.open = c.open;
         ohlcv.high = c.high;
         ohlcv.low = c.low;
         ohlcv.close = c.close;
         ohlcv.volume = c.volume;
-        it->second.minute1Candles.push_back(ohlcv);
+        data->series[0].candles.push(ohlcv);
+
+        for (size_t i = 1; i + 1 < data->series.size(); ++i) {
+            discarded.count = 0;
+            rollUp(data->series[i], ohlcv, discarded);
+        }
     }
 
-    std::cout << "Loaded " << dailyCandles.size() << " daily candles and "
-              << minuteCandles.size() << " minute candles for " << code << std::endl;
+    stats.dailyCandles = dailyCandles.size();
+    stats.minuteCandles = minuteCandles.size();
+    return data;
+}
 
-    return true;
+std::unique_ptr<MarketDataManager::StockData> MarketDataManager::buildHistoryFromBarFile(
+    const BarSeriesView& view, const std::vector<int>& timeframes,
+    HistoryLoadStats& stats) {
+
+    std::unique_ptr<StockData> data = createStockData(timeframes);
+
+    // 링 버퍼에 남을 구간만 매핑된 컬럼에서 직접 읽음
+    // (상위 분봉 최대 60분봉까지 용량을 채울 수 있는 만큼)
+    size_t start = view.count > MINUTE_CANDLE_CAPACITY * 60 ?
+        view.count - MINUTE_CANDLE_CAPACITY * 60 : 0;
+
+    CompletedCandles discarded;
+    for (size_t i = start; i < view.count; ++i) {
+        OHLCV bar = view.at(i);
+        data->series[0].candles.push(bar);
+
+        for (size_t s = 1; s + 1 < data->series.size(); ++s) {
+            discarded.count = 0;
+            rollUp(data->series[s], bar, discarded);
+        }
+    }
+
+    stats.minuteCandles = view.count - start;
+    return data;
 }
 
-void MarketDataManager::clearCache(const std::string& code) {
-    std::lock_guard<std::mutex> lock(dataMutex);
+void MarketDataManager::publishStockData(SymbolId id, std::unique_ptr<StockData> data) {
+    {
+        std::lock_guard<std::mutex> lock(shardMutex(id));
+
+        // 기존 데이터의 누적 거래량 기준은 이어받음 (실시간 거래량 차분 유지)
+        if (stocks[id]) {
+            data->lastCumVolume = stocks[id]->lastCumVolume;
+        }
+        stocks[id].swap(data);
+    }
+    // 이전 데이터는 락 밖에서 해제
+}
 
+void MarketDataManager::clearCache(const std::string& code) {
     if (code.empty()) {
-        stockData.clear();
+        size_t symbolCount = SymbolRegistry::instance().size();
+        for (size_t i = 0; i < symbolCount; ++i) {
+            SymbolId id = static_cast<SymbolId>(i);
+            std::lock_guard<std::mutex> lock(shardMutex(id));
+            stocks[id].reset();
+            resetSnapshots(id);
+        }
     } else {
-        stockData.erase(code);
+        SymbolId id = SymbolRegistry::instance().find(code);
+        if (id == INVALID_SYMBOL_ID) return;
+
+        std::lock_guard<std::mutex> lock(shardMutex(id));
+        stocks[id].reset();
+        resetSnapshots(id);
     }
 }
 
 size_t MarketDataManager::getCacheSize() const {
-    std::lock_guard<std::mutex> lock(dataMutex);
-
     size_t totalSize = 0;
-    for (const auto& entry : stockData) {
-        totalSize += entry.second.minute1Candles.size() * sizeof(OHLCV);
-        totalSize += entry.second.minute5Candles.size() * sizeof(OHLCV);
-        totalSize += entry.second.dailyCandles.size() * sizeof(OHLCV);
+
+    size_t symbolCount = SymbolRegistry::instance().size();
+    for (size_t i = 0; i < symbolCount; ++i) {
+        SymbolId id = static_cast<SymbolId>(i);
+        std::lock_guard<std::mutex> lock(shardMutex(id));
+
+        const StockData* data = stockFor(id);
+        if (!data) continue;
+
+        for (const auto& series : data->series) {
+            totalSize += series.candles.capacity() * sizeof(OHLCV);
+        }
     }
 
     return totalSize;
 }
 
 bool MarketDataManager::isMarketOpen() const {
-    auto now = std::chrono::system_clock::now();
-    std::time_t t = std::chrono::system_clock::to_time_t(now);
-    std::tm* tm = std::localtime(&t);
-
-    // 주말 체크
-    if (tm->tm_wday == 0 || tm->tm_wday == 6) return false;
-
-    int minutes = tm->tm_hour * 60 + tm->tm_min;
-    return minutes >= 540 && minutes <= 930;  // 09:00 ~ 15:30
+    // 평일 09:00 ~ 15:30
+    return currentClock().session().isMarketHours();
 }
 
 int MarketDataManager::getMinutesSinceOpen() const {
-    auto now = std::chrono::system_clock::now();
-    std::time_t t = std::chrono::system_clock::to_time_t(now);
-    std::tm* tm = std::localtime(&t);
-
-    int currentMinutes = tm->tm_hour * 60 + tm->tm_min;
-    int marketOpen = 540;  // 09:00
-
-    if (currentMinutes < marketOpen) return 0;
-    return currentMinutes - marketOpen;
+    return currentClock().session().minutesSinceOpen();
 }
 
 // ============================================================================
@@ -352,43 +915,66 @@ HistoricalDataLoader::HistoricalDataLoader()
 
 bool HistoricalDataLoader::loadFromCSV(const std::string& filepath,
                                         std::vector<OHLCV>& candles) {
-    std::ifstream file(filepath);
-    if (!file.is_open()) {
+    // CSV 형식: timestamp,open,high,low,close,volume
+    CSVParseResult result;
+    if (!CSVBarParser::parseFile(filepath, candles, &result)) {
+        std::cerr << "Failed to open file: " << filepath << std::endl;
+        return false;
+    }
+
+    std::cout << "Loaded " << candles.size() << " candles from " << filepath << std::endl;
+    return true;
+}
+
+bool HistoricalDataLoader::loadFromBinary(const std::string& filepath,
+                                          const std::string& code,
+                                          std::vector<OHLCV>& candles) {
+    BarFileReader reader;
+    if (!reader.open(filepath)) {
         std::cerr << "Failed to open file: " << filepath << std::endl;
         return false;
     }
 
-    std::string line;
+    BarSeriesView view;
+    if (!reader.find(code, view)) {
+        std::cerr << "Symbol " << code << " not found in " << filepath << std::endl;
+        return false;
+    }
+
+    view.appendTo(candles);
+    return true;
+}
 
-    // 헤더 스킵
-    std::getline(file, line);
+bool HistoricalDataLoader::convertCSVToBinary(
+    const std::vector<std::pair<std::string, std::string>>& sources,
+    const std::string& outputPath) {
 
-    while (std::getline(file, line)) {
-        std::stringstream ss(line);
-        std::string token;
-        OHLCV candle;
+    BarFileWriter writer;
+    if (!writer.open(outputPath)) {
+        return false;
+    }
 
-        // CSV 형식: timestamp,open,high,low,close,volume
-        int col = 0;
-        while (std::getline(ss, token, ',')) {
-            switch (col) {
-                case 0: candle.timestamp = std::stoll(token); break;
-                case 1: candle.open = std::stod(token); break;
-                case 2: candle.high = std::stod(token); break;
-                case 3: candle.low = std::stod(token); break;
-                case 4: candle.close = std::stod(token); break;
-                case 5: candle.volume = std::stoll(token); break;
-            }
-            col++;
-        }
+    std::vector<OHLCV> candles;
+    size_t converted = 0;
 
-        if (col >= 6) {
-            candles.push_back(candle);
+    for (const auto& source : sources) {
+        candles.clear();
+        if (!loadFromCSV(source.second, candles)) {
+            continue;
         }
+        if (!writer.addSeries(source.first, candles)) {
+            return false;
+        }
+        converted++;
     }
 
-    std::cout << "Loaded " << candles.size() << " candles from " << filepath << std::endl;
-    return true;
+    if (!writer.finish()) {
+        return false;
+    }
+
+    std::cout << "Converted " << converted << "/" << sources.size()
+              << " CSV files to " << outputPath << std::endl;
+    return converted == sources.size();
 }
 
 bool HistoricalDataLoader::downloadAndSave(YuantaAPI* api,
@@ -403,6 +989,32 @@ bool HistoricalDataLoader::downloadAndSave(YuantaAPI* api,
         return false;
     }
 
+    // 바이너리 형식
+    const std::string binaryExt = ".ybar";
+    if (outputPath.size() > binaryExt.size() &&
+        outputPath.compare(outputPath.size() - binaryExt.size(), binaryExt.size(), binaryExt) == 0) {
+        std::vector<OHLCV> bars;
+        bars.reserve(candles.size());
+        for (const auto& c : candles) {
+            OHLCV bar;
+            bar.timestamp = c.timestamp;
+            bar.open = c.open;
+            bar.high = c.high;
+            bar.low = c.low;
+            bar.close = c.close;
+            bar.volume = c.volume;
+            bars.push_back(bar);
+        }
+
+        BarFileWriter writer;
+        if (!writer.open(outputPath) || !writer.addSeries(code, bars) || !writer.finish()) {
+            return false;
+        }
+
+        std::cout << "Saved " << candles.size() << " candles to " << outputPath << std::endl;
+        return true;
+    }
+
     std::ofstream file(outputPath);
     if (!file.is_open()) {
         std::cerr << "Failed to create file: " << outputPath << std::endl;
@@ -427,15 +1039,14 @@ bool HistoricalDataLoader::downloadAndSave(YuantaAPI* api,
 std::vector<OHLCV> HistoricalDataLoader::filterByDate(const std::vector<OHLCV>& candles,
                                                        long long startTime,
                                                        long long endTime) {
-    std::vector<OHLCV> filtered;
-
-    for (const auto& candle : candles) {
-        if (candle.timestamp >= startTime && candle.timestamp <= endTime) {
-            filtered.push_back(candle);
-        }
-    }
+    Span<OHLCV> range = sliceByDate(candles, startTime, endTime);
+    return std::vector<OHLCV>(range.begin(), range.end());
+}
 
-    return filtered;
+Span<OHLCV> HistoricalDataLoader::sliceByDate(const std::vector<OHLCV>& candles,
+                                              long long startTime,
+                                              long long endTime) const {
+    return barsBetween(candles, startTime, endTime);
 }
 
 } // namespace yuanta
@@ -0,0 +1,59 @@
+#include "../../include/SymbolRegistry.h"
+#include <iostream>
+
+namespace yuanta {
+
+SymbolRegistry& SymbolRegistry::instance() {
+    static SymbolRegistry registry;
+    return registry;
+}
+
+SymbolRegistry::SymbolRegistry()
+    : codes(new std::string[MAX_SYMBOLS]) {
+    index.reserve(256);
+}
+
+SymbolId SymbolRegistry::intern(const std::string& code) {
+    {
+        std::shared_lock<std::shared_mutex> readLock(mtx);
+        auto it = index.find(code);
+        if (it != index.end()) {
+            return it->second;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mtx);
+
+    auto it = index.find(code);
+    if (it != index.end()) {
+        return it->second;
+    }
+
+    size_t next = count.load(std::memory_order_relaxed);
+    if (next >= MAX_SYMBOLS) {
+        std::cerr << "SymbolRegistry full, cannot register " << code << std::endl;
+        return INVALID_SYMBOL_ID;
+    }
+
+    // 문자열을 먼저 기록한 뒤 개수를 공개 (락 없는 code() 읽기 보장)
+    codes[next] = code;
+    SymbolId id = static_cast<SymbolId>(next);
+    index.emplace(code, id);
+    count.store(next + 1, std::memory_order_release);
+
+    return id;
+}
+
+SymbolId SymbolRegistry::find(const std::string& code) const {
+    std::shared_lock<std::shared_mutex> lock(mtx);
+
+    auto it = index.find(code);
+    return it != index.end() ? it->second : INVALID_SYMBOL_ID;
+}
+
+const std::string& SymbolRegistry::code(SymbolId id) const {
+    static const std::string empty;
+    return isValid(id) ? codes[id] : empty;
+}
+
+} // namespace yuanta
@@ -0,0 +1,411 @@
+#include "../../include/BatchIndicators.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#include <arm_neon.h>
+#define YUANTA_BATCH_NEON
+#endif
+
+namespace yuanta {
+
+// ============================================================================
+// SIMD 레인 추상화
+// ============================================================================
+
+namespace {
+
+const double kNaN = std::numeric_limits<double>::quiet_NaN();
+
+// 스칼라 (잔여 종목 처리 및 기본 백엔드)
+struct ScalarLanes {
+    using reg = double;
+    static constexpr size_t width = 1;
+
+    static reg load(const double* p) { return *p; }
+    static void store(double* p, reg v) { *p = v; }
+    static reg set1(double v) { return v; }
+    static reg add(reg a, reg b) { return a + b; }
+    static reg sub(reg a, reg b) { return a - b; }
+    static reg mul(reg a, reg b) { return a * b; }
+    static reg div(reg a, reg b) { return a / b; }
+    static reg max(reg a, reg b) { return a > b ? a : b; }
+    static reg abs(reg a) { return std::abs(a); }
+    static reg sqrt(reg a) { return std::sqrt(a); }
+    // a == 0 이면 ifZero, 아니면 otherwise
+    static reg selectZero(reg a, reg ifZero, reg otherwise) { return a == 0.0 ? ifZero : otherwise; }
+};
+
+#if defined(__AVX2__)
+struct VectorLanes {
+    using reg = __m256d;
+    static constexpr size_t width = 4;
+
+    static reg load(const double* p) { return _mm256_loadu_pd(p); }
+    static void store(double* p, reg v) { _mm256_storeu_pd(p, v); }
+    static reg set1(double v) { return _mm256_set1_pd(v); }
+    static reg add(reg a, reg b) { return _mm256_add_pd(a, b); }
+    static reg sub(reg a, reg b) { return _mm256_sub_pd(a, b); }
+    static reg mul(reg a, reg b) { return _mm256_mul_pd(a, b); }
+    static reg div(reg a, reg b) { return _mm256_div_pd(a, b); }
+    static reg max(reg a, reg b) { return _mm256_max_pd(a, b); }
+    static reg abs(reg a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+    static reg sqrt(reg a) { return _mm256_sqrt_pd(a); }
+    static reg selectZero(reg a, reg ifZero, reg otherwise) {
+        reg mask = _mm256_cmp_pd(a, _mm256_setzero_pd(), _CMP_EQ_OQ);
+        return _mm256_blendv_pd(otherwise, ifZero, mask);
+    }
+};
+const char* kBackendName = "AVX2";
+#elif defined(YUANTA_BATCH_NEON)
+struct VectorLanes {
+    using reg = float64x2_t;
+    static constexpr size_t width = 2;
+
+    static reg load(const double* p) { return vld1q_f64(p); }
+    static void store(double* p, reg v) { vst1q_f64(p, v); }
+    static reg set1(double v) { return vdupq_n_f64(v); }
+    static reg add(reg a, reg b) { return vaddq_f64(a, b); }
+    static reg sub(reg a, reg b) { return vsubq_f64(a, b); }
+    static reg mul(reg a, reg b) { return vmulq_f64(a, b); }
+    static reg div(reg a, reg b) { return vdivq_f64(a, b); }
+    static reg max(reg a, reg b) { return vmaxq_f64(a, b); }
+    static reg abs(reg a) { return vabsq_f64(a); }
+    static reg sqrt(reg a) { return vsqrtq_f64(a); }
+    static reg selectZero(reg a, reg ifZero, reg otherwise) {
+        return vbslq_f64(vceqq_f64(a, vdupq_n_f64(0.0)), ifZero, otherwise);
+    }
+};
+const char* kBackendName = "NEON";
+#else
+using VectorLanes = ScalarLanes;
+const char* kBackendName = "Scalar";
+#endif
+
+// 종목 방향으로 레인 폭만큼 나누어 kernel(L, symbolOffset, firstBar)를 호출
+// 레인 묶음의 첫 유효 봉이 모두 같을 때만 벡터 레인을 쓰고, 다르면 종목별 스칼라로
+// 처리한다 (잔여 종목도 스칼라).
+template <typename Kernel>
+void forEachLane(const CandleBlock& b, Kernel&& kernel) {
+    size_t s = 0;
+    for (; s + VectorLanes::width <= b.numSymbols; s += VectorLanes::width) {
+        size_t start = b.firstValidBar(s);
+        bool aligned = true;
+        for (size_t k = 1; k < VectorLanes::width; ++k) {
+            aligned = aligned && b.firstValidBar(s + k) == start;
+        }
+        if (aligned) {
+            kernel(VectorLanes(), s, start);
+        } else {
+            for (size_t k = 0; k < VectorLanes::width; ++k) {
+                kernel(ScalarLanes(), s + k, b.firstValidBar(s + k));
+            }
+        }
+    }
+    for (; s < b.numSymbols; ++s) {
+        kernel(ScalarLanes(), s, b.firstValidBar(s));
+    }
+}
+
+// 첫 유효 봉 앞의 패딩 구간 [0, start)를 NaN으로
+template <typename L>
+void storePadding(double* out, const CandleBlock& b, size_t s, size_t start) {
+    typename L::reg nan = L::set1(kNaN);
+    for (size_t t = 0; t < start && t < b.numBars; ++t) {
+        L::store(out + t * b.numSymbols + s, nan);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// 커널: 첫 유효 봉 start부터 시간 방향으로 진행하며 종목별 상태를 레인 단위로 갱신
+// (u = t - start 가 종목 자기 시리즈에서의 봉 위치)
+// ----------------------------------------------------------------------------
+
+template <typename L>
+void smaKernel(L, const CandleBlock& b, size_t s, size_t start, int period, double* out) {
+    const size_t n = b.numSymbols;
+    const double* x = b.close.data();
+    const size_t p = static_cast<size_t>(period);
+    typename L::reg sum = L::set1(0.0);
+    typename L::reg inv = L::set1(1.0 / period);
+    typename L::reg nan = L::set1(kNaN);
+
+    storePadding<L>(out, b, s, start);
+    for (size_t t = start; t < b.numBars; ++t) {
+        size_t u = t - start;
+        sum = L::add(sum, L::load(x + t * n + s));
+        if (u >= p) {
+            sum = L::sub(sum, L::load(x + (t - p) * n + s));
+        }
+        L::store(out + t * n + s, u + 1 >= p ? L::mul(sum, inv) : nan);
+    }
+}
+
+template <typename L>
+void emaKernel(L, const CandleBlock& b, size_t s, size_t start, int period, double* out) {
+    const size_t n = b.numSymbols;
+    const double* x = b.close.data();
+    const size_t p = static_cast<size_t>(period);
+    typename L::reg ema = L::set1(0.0);
+    typename L::reg k = L::set1(2.0 / (period + 1));
+    typename L::reg nan = L::set1(kNaN);
+
+    storePadding<L>(out, b, s, start);
+    for (size_t t = start; t < b.numBars; ++t) {
+        size_t u = t - start;
+        typename L::reg price = L::load(x + t * n + s);
+        if (u < p) {
+            // 첫 EMA는 SMA로 시작
+            ema = L::add(ema, price);
+            if (u + 1 == p) {
+                ema = L::mul(ema, L::set1(1.0 / period));
+                L::store(out + t * n + s, ema);
+            } else {
+                L::store(out + t * n + s, nan);
+            }
+        } else {
+            ema = L::add(L::mul(L::sub(price, ema), k), ema);
+            L::store(out + t * n + s, ema);
+        }
+    }
+}
+
+template <typename L>
+void rsiKernel(L, const CandleBlock& b, size_t s, size_t start, int period, double* out) {
+    const size_t n = b.numSymbols;
+    const double* x = b.close.data();
+    const size_t p = static_cast<size_t>(period);
+    typename L::reg zero = L::set1(0.0);
+    typename L::reg hundred = L::set1(100.0);
+    typename L::reg nan = L::set1(kNaN);
+    typename L::reg avgGain = zero;
+    typename L::reg avgLoss = zero;
+    typename L::reg keep = L::set1(static_cast<double>(period - 1));
+    typename L::reg inv = L::set1(1.0 / period);
+
+    storePadding<L>(out, b, s, start);
+    if (start < b.numBars) L::store(out + start * n + s, nan);
+
+    for (size_t t = start + 1; t < b.numBars; ++t) {
+        size_t u = t - start;
+        typename L::reg change = L::sub(L::load(x + t * n + s), L::load(x + (t - 1) * n + s));
+        typename L::reg gain = L::max(change, zero);
+        typename L::reg loss = L::max(L::sub(zero, change), zero);
+
+        if (u <= p) {
+            avgGain = L::add(avgGain, gain);
+            avgLoss = L::add(avgLoss, loss);
+            if (u < p) {
+                L::store(out + t * n + s, nan);
+                continue;
+            }
+            avgGain = L::mul(avgGain, inv);
+            avgLoss = L::mul(avgLoss, inv);
+        } else {
+            // Wilder 스무딩
+            avgGain = L::mul(L::add(L::mul(avgGain, keep), gain), inv);
+            avgLoss = L::mul(L::add(L::mul(avgLoss, keep), loss), inv);
+        }
+
+        // RSI = 100 - 100 / (1 + G/L) = 100 * G / (G + L), 손실 0이면 100
+        typename L::reg rsi = L::div(L::mul(hundred, avgGain), L::add(avgGain, avgLoss));
+        L::store(out + t * n + s, L::selectZero(avgLoss, hundred, rsi));
+    }
+}
+
+template <typename L>
+void bollingerKernel(L, const CandleBlock& b, size_t s, size_t start, int period,
+                     double stdDev, BatchBands& out) {
+    const size_t n = b.numSymbols;
+    const double* x = b.close.data();
+    const size_t p = static_cast<size_t>(period);
+    typename L::reg zero = L::set1(0.0);
+    typename L::reg nan = L::set1(kNaN);
+    typename L::reg inv = L::set1(1.0 / period);
+    typename L::reg width = L::set1(stdDev);
+    typename L::reg sum = zero;
+    typename L::reg sumSq = zero;
+
+    // 첫 유효 봉 가격만큼 이동시켜 제곱합의 자릿수 손실을 줄임
+    typename L::reg shift = start < b.numBars ? L::load(x + start * n + s) : zero;
+
+    storePadding<L>(out.upper.data(), b, s, start);
+    storePadding<L>(out.middle.data(), b, s, start);
+    storePadding<L>(out.lower.data(), b, s, start);
+    storePadding<L>(out.bandwidth.data(), b, s, start);
+
+    for (size_t t = start; t < b.numBars; ++t) {
+        size_t u = t - start;
+        typename L::reg v = L::sub(L::load(x + t * n + s), shift);
+        sum = L::add(sum, v);
+        sumSq = L::add(sumSq, L::mul(v, v));
+        if (u >= p) {
+            typename L::reg old = L::sub(L::load(x + (t - p) * n + s), shift);
+            sum = L::sub(sum, old);
+            sumSq = L::sub(sumSq, L::mul(old, old));
+        }
+
+        size_t idx = t * n + s;
+        if (u + 1 < p) {
+            L::store(out.upper.data() + idx, nan);
+            L::store(out.middle.data() + idx, nan);
+            L::store(out.lower.data() + idx, nan);
+            L::store(out.bandwidth.data() + idx, nan);
+            continue;
+        }
+
+        typename L::reg mean = L::mul(sum, inv);
+        typename L::reg variance = L::max(L::sub(L::mul(sumSq, inv), L::mul(mean, mean)), zero);
+        typename L::reg band = L::mul(L::sqrt(variance), width);
+        typename L::reg middle = L::add(mean, shift);
+        typename L::reg upper = L::add(middle, band);
+        typename L::reg lower = L::sub(middle, band);
+
+        L::store(out.upper.data() + idx, upper);
+        L::store(out.middle.data() + idx, middle);
+        L::store(out.lower.data() + idx, lower);
+        L::store(out.bandwidth.data() + idx, L::div(L::sub(upper, lower), middle));
+    }
+}
+
+template <typename L>
+void atrKernel(L, const CandleBlock& b, size_t s, size_t start, int period, double* out) {
+    const size_t n = b.numSymbols;
+    const size_t p = static_cast<size_t>(period);
+    typename L::reg nan = L::set1(kNaN);
+    typename L::reg keep = L::set1(static_cast<double>(period - 1));
+    typename L::reg inv = L::set1(1.0 / period);
+    typename L::reg atr = L::set1(0.0);
+
+    storePadding<L>(out, b, s, start);
+    if (start < b.numBars) L::store(out + start * n + s, nan);
+
+    for (size_t t = start + 1; t < b.numBars; ++t) {
+        size_t u = t - start;
+        size_t idx = t * n + s;
+        typename L::reg high = L::load(b.high.data() + idx);
+        typename L::reg low = L::load(b.low.data() + idx);
+        typename L::reg prevClose = L::load(b.close.data() + idx - n);
+
+        typename L::reg tr = L::max(L::sub(high, low),
+                                    L::max(L::abs(L::sub(high, prevClose)),
+                                           L::abs(L::sub(low, prevClose))));
+
+        if (u <= p) {
+            atr = L::add(atr, tr);
+            if (u < p) {
+                L::store(out + idx, nan);
+                continue;
+            }
+            atr = L::mul(atr, inv);
+        } else {
+            atr = L::mul(L::add(L::mul(atr, keep), tr), inv);
+        }
+        L::store(out + idx, atr);
+    }
+}
+
+} // namespace
+
+// ============================================================================
+// CandleBlock
+// ============================================================================
+
+void CandleBlock::resize(size_t symbols, size_t bars) {
+    numSymbols = symbols;
+    numBars = bars;
+    size_t total = symbols * bars;
+    open.assign(total, kNaN);
+    high.assign(total, kNaN);
+    low.assign(total, kNaN);
+    close.assign(total, kNaN);
+    volume.assign(total, kNaN);
+    firstValid.assign(symbols, bars);
+}
+
+void CandleBlock::setSeries(size_t symbol, const std::vector<OHLCV>& candles) {
+    if (symbol >= numSymbols) return;
+    if (firstValid.size() != numSymbols) firstValid.resize(numSymbols, numBars);
+
+    size_t count = (std::min)(candles.size(), numBars);
+    size_t firstBar = numBars - count;
+    size_t firstCandle = candles.size() - count;
+
+    for (size_t t = 0; t < firstBar; ++t) {
+        size_t idx = index(t, symbol);
+        open[idx] = high[idx] = low[idx] = close[idx] = volume[idx] = kNaN;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        const OHLCV& c = candles[firstCandle + i];
+        size_t idx = index(firstBar + i, symbol);
+        open[idx] = c.open;
+        high[idx] = c.high;
+        low[idx] = c.low;
+        close[idx] = c.close;
+        volume[idx] = static_cast<double>(c.volume);
+    }
+    firstValid[symbol] = firstBar;
+}
+
+// ============================================================================
+// BatchIndicators
+// ============================================================================
+
+void BatchIndicators::SMA(const CandleBlock& block, int period, std::vector<double>& out) {
+    out.resize(block.numSymbols * block.numBars);
+    if (period <= 0) return;
+    forEachLane(block, [&](auto lanes, size_t s, size_t start) {
+        smaKernel(lanes, block, s, start, period, out.data());
+    });
+}
+
+void BatchIndicators::EMA(const CandleBlock& block, int period, std::vector<double>& out) {
+    out.resize(block.numSymbols * block.numBars);
+    if (period <= 0) return;
+    forEachLane(block, [&](auto lanes, size_t s, size_t start) {
+        emaKernel(lanes, block, s, start, period, out.data());
+    });
+}
+
+void BatchIndicators::RSI(const CandleBlock& block, int period, std::vector<double>& out) {
+    out.resize(block.numSymbols * block.numBars);
+    if (period <= 0) return;
+    forEachLane(block, [&](auto lanes, size_t s, size_t start) {
+        rsiKernel(lanes, block, s, start, period, out.data());
+    });
+}
+
+void BatchIndicators::BollingerBand(const CandleBlock& block, int period, double stdDev,
+                                    BatchBands& out) {
+    size_t total = block.numSymbols * block.numBars;
+    out.upper.resize(total);
+    out.middle.resize(total);
+    out.lower.resize(total);
+    out.bandwidth.resize(total);
+    if (period <= 0) return;
+    forEachLane(block, [&](auto lanes, size_t s, size_t start) {
+        bollingerKernel(lanes, block, s, start, period, stdDev, out);
+    });
+}
+
+void BatchIndicators::ATR(const CandleBlock& block, int period, std::vector<double>& out) {
+    out.resize(block.numSymbols * block.numBars);
+    if (period <= 0) return;
+    forEachLane(block, [&](auto lanes, size_t s, size_t start) {
+        atrKernel(lanes, block, s, start, period, out.data());
+    });
+}
+
+const char* BatchIndicators::backendName() {
+    return kBackendName;
+}
+
+size_t BatchIndicators::laneWidth() {
+    return VectorLanes::width;
+}
+
+} // namespace yuanta
@@ -0,0 +1,361 @@
+#include "../../include/IndicatorCache.h"
+#include <tuple>
+#include <algorithm>
+
+namespace yuanta {
+
+// ============================================================================
+// IndicatorKey
+// ============================================================================
+
+bool IndicatorKey::operator<(const IndicatorKey& other) const {
+    return std::tie(type, param1, param2, param3, param4) <
+           std::tie(other.type, other.param1, other.param2, other.param3, other.param4);
+}
+
+// ============================================================================
+// IndicatorColumns
+// ============================================================================
+
+namespace {
+
+const MACDResult EMPTY_MACD = {0, 0, 0, false, false};
+
+// 긴 시리즈용 이동평균 (SMAVector와 같은 정렬)
+// 이동 합을 수만 봉 동안 더하고 빼면 가격대가 크게 변한 뒤 반올림 오차가 평균을 덮으므로
+// period개마다 합을 새로 구해 오차가 lookback 구간 계산과 같은 수준을 넘지 않게 한다.
+std::vector<double> rollingSMA(Span<double> prices, int period) {
+    std::vector<double> result;
+    if (period <= 0 || prices.size() < static_cast<size_t>(period)) return result;
+    result.reserve(prices.size() - period + 1);
+
+    size_t n = static_cast<size_t>(period);
+    double sum = 0.0;
+    for (size_t i = 0; i < prices.size(); ++i) {
+        if (i >= n && (i + 1) % n != 0) {
+            sum += prices[i] - prices[i - n];
+        } else if (i + 1 >= n) {
+            sum = 0.0;
+            for (size_t j = i + 1 - n; j <= i; ++j) {
+                sum += prices[j];
+            }
+        }
+        if (i + 1 >= n) {
+            result.push_back(sum / period);
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+IndicatorColumns::IndicatorColumns(Span<OHLCV> candles, Span<double> closes,
+                                   const std::vector<IndicatorKey>& keys)
+    : candles(candles), closes(closes) {
+    for (const auto& key : keys) {
+        add(key);
+    }
+}
+
+size_t IndicatorColumns::warmup(const IndicatorKey& key) {
+    size_t period = static_cast<size_t>((std::max)(key.param1, 1));
+    switch (key.type) {
+        case IndicatorType::RSI:
+        case IndicatorType::ATR:
+            return period;
+        default:
+            return period - 1;
+    }
+}
+
+bool IndicatorColumns::add(const IndicatorKey& key) {
+    switch (key.type) {
+        case IndicatorType::SMA:
+            if (!seriesColumns.count(key)) {
+                seriesColumns.emplace(key, rollingSMA(closes, key.param1));
+            }
+            return true;
+        case IndicatorType::EMA:
+            if (!seriesColumns.count(key)) {
+                seriesColumns.emplace(key, TechnicalIndicators::EMAVector(closes, key.param1));
+            }
+            return true;
+        case IndicatorType::RSI:
+            if (!seriesColumns.count(key)) {
+                seriesColumns.emplace(key, TechnicalIndicators::RSIVector(closes, key.param1));
+            }
+            return true;
+        case IndicatorType::ATR:
+            if (!seriesColumns.count(key)) {
+                seriesColumns.emplace(key, TechnicalIndicators::ATRVector(candles, key.param1));
+            }
+            return true;
+        case IndicatorType::BOLLINGER:
+            if (!bandColumns.count(key)) {
+                bandColumns.emplace(key,
+                    TechnicalIndicators::BollingerBandVector(closes, key.param1, key.param4));
+            }
+            return true;
+        case IndicatorType::MACD:
+            break;
+        default:
+            return false;
+    }
+
+    if (macdColumns.count(key)) return true;
+
+    // MACD: 빠른/느린 EMA와 시그널 EMA를 전 구간에 대해 한 번씩 계산한 뒤 봉별 결과로 펼침
+    int fastPeriod = key.param1, slowPeriod = key.param2, signalPeriod = key.param3;
+    std::vector<MACDResult> column(candles.size(), EMPTY_MACD);
+
+    auto fastEMA = TechnicalIndicators::EMAVector(closes, fastPeriod);
+    auto slowEMA = TechnicalIndicators::EMAVector(closes, slowPeriod);
+
+    std::vector<double> macdLine;
+    size_t offset = slowPeriod - fastPeriod;
+    for (size_t i = 0; i < slowEMA.size(); ++i) {
+        macdLine.push_back(fastEMA[i + offset] - slowEMA[i]);
+    }
+    auto signalLine = TechnicalIndicators::EMAVector(macdLine, signalPeriod);
+
+    // signalLine[k] ↔ macdLine[k + signalPeriod - 1] ↔ 봉 k + signalPeriod + slowPeriod - 2
+    size_t first = static_cast<size_t>(signalPeriod + slowPeriod - 2);
+    for (size_t k = 0; k < signalLine.size(); ++k) {
+        MACDResult& r = column[first + k];
+        size_t m = k + signalPeriod - 1;
+        r.macd = macdLine[m];
+        r.signal = signalLine[k];
+        r.histogram = r.macd - r.signal;
+        if (k > 0) {
+            r.bullishCross = (macdLine[m - 1] < signalLine[k - 1]) && (r.macd > r.signal);
+            r.bearishCross = (macdLine[m - 1] > signalLine[k - 1]) && (r.macd < r.signal);
+        }
+    }
+
+    macdColumns.emplace(key, std::move(column));
+    return true;
+}
+
+size_t IndicatorColumns::size() const {
+    return seriesColumns.size() + bandColumns.size() + macdColumns.size();
+}
+
+bool IndicatorColumns::series(const IndicatorKey& key, size_t begin, size_t length,
+                              Span<double>& out) const {
+    auto it = seriesColumns.find(key);
+    if (it == seriesColumns.end()) return false;
+
+    // 구간 계산 결과의 첫 값은 봉 begin + warmup → 전 구간 결과의 begin번째 값
+    size_t w = warmup(key);
+    out = Span<double>(it->second).subspan(begin, length > w ? length - w : 0);
+    return true;
+}
+
+bool IndicatorColumns::bands(const IndicatorKey& key, size_t begin, size_t length,
+                             Span<BollingerBands>& out) const {
+    auto it = bandColumns.find(key);
+    if (it == bandColumns.end()) return false;
+
+    size_t w = warmup(key);
+    out = Span<BollingerBands>(it->second).subspan(begin, length > w ? length - w : 0);
+    return true;
+}
+
+const MACDResult* IndicatorColumns::macd(const IndicatorKey& key, size_t begin,
+                                         size_t length) const {
+    auto it = macdColumns.find(key);
+    if (it == macdColumns.end()) return nullptr;
+
+    // 구간이 시그널 라인을 만들기에 짧으면 구간 계산과 마찬가지로 빈 결과
+    size_t needed = static_cast<size_t>(key.param2 + key.param3 - 1);
+    if (length == 0 || length < needed || begin + length > it->second.size()) {
+        return &EMPTY_MACD;
+    }
+    return &it->second[begin + length - 1];
+}
+
+// ============================================================================
+// IndicatorContext
+// ============================================================================
+
+IndicatorContext::IndicatorContext(const std::string& code, int timeframe,
+                                   const std::vector<OHLCV>& candles)
+    : code(code), symbolId(SymbolRegistry::instance().intern(code)),
+      timeframe(timeframe), ownedCandles(candles) {
+    this->candles = Span<OHLCV>(ownedCandles);
+
+    ownedCloses.reserve(ownedCandles.size());
+    for (const auto& candle : ownedCandles) {
+        ownedCloses.push_back(candle.close);
+    }
+    this->closes = Span<double>(ownedCloses);
+}
+
+IndicatorContext::IndicatorContext(const std::string& code, int timeframe,
+                                   Span<OHLCV> candles, Span<double> closes)
+    : IndicatorContext(code, SymbolRegistry::instance().intern(code), timeframe,
+                       candles, closes) {}
+
+IndicatorContext::IndicatorContext(const std::string& code, int timeframe,
+                                   Span<OHLCV> candles, Span<double> closes,
+                                   const IndicatorColumns* columns, size_t columnOffset)
+    : IndicatorContext(code, SymbolRegistry::instance().intern(code), timeframe,
+                       candles, closes, columns, columnOffset) {}
+
+IndicatorContext::IndicatorContext(const std::string& code, SymbolId symbolId, int timeframe,
+                                   Span<OHLCV> candles, Span<double> closes,
+                                   const IndicatorColumns* columns, size_t columnOffset)
+    : code(code), symbolId(symbolId), timeframe(timeframe), candles(candles), closes(closes),
+      columns(columns), columnOffset(columnOffset) {
+    if (closes.size() != candles.size()) {
+        ownedCloses.reserve(candles.size());
+        for (const auto& candle : candles) {
+            ownedCloses.push_back(candle.close);
+        }
+        this->closes = Span<double>(ownedCloses);
+    }
+}
+
+long long IndicatorContext::getLastBarTime() const {
+    return candles.empty() ? 0 : candles.back().timestamp;
+}
+
+Span<double> IndicatorContext::cachedSeries(const IndicatorKey& key) const {
+    if (columns) {
+        Span<double> view;
+        if (columns->series(key, columnOffset, candles.size(), view)) {
+            return view;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto it = seriesCache.find(key);
+    if (it == seriesCache.end()) {
+        std::vector<double> values;
+        switch (key.type) {
+            case IndicatorType::SMA: values = TechnicalIndicators::SMAVector(closes, key.param1); break;
+            case IndicatorType::EMA: values = TechnicalIndicators::EMAVector(closes, key.param1); break;
+            case IndicatorType::RSI: values = TechnicalIndicators::RSIVector(closes, key.param1); break;
+            case IndicatorType::ATR: values = TechnicalIndicators::ATRVector(candles, key.param1); break;
+            case IndicatorType::VWAP: values = TechnicalIndicators::VWAPVector(candles); break;
+            default: break;
+        }
+        it = seriesCache.emplace(key, std::move(values)).first;
+    }
+    return Span<double>(it->second);
+}
+
+Span<double> IndicatorContext::sma(int period) const {
+    return cachedSeries(IndicatorKey{IndicatorType::SMA, period});
+}
+
+Span<double> IndicatorContext::ema(int period) const {
+    return cachedSeries(IndicatorKey{IndicatorType::EMA, period});
+}
+
+Span<double> IndicatorContext::rsi(int period) const {
+    return cachedSeries(IndicatorKey{IndicatorType::RSI, period});
+}
+
+Span<double> IndicatorContext::atr(int period) const {
+    return cachedSeries(IndicatorKey{IndicatorType::ATR, period});
+}
+
+Span<double> IndicatorContext::vwap() const {
+    return cachedSeries(IndicatorKey{IndicatorType::VWAP});
+}
+
+Span<BollingerBands> IndicatorContext::bollinger(int period, double stdDev) const {
+    IndicatorKey key{IndicatorType::BOLLINGER, period, 0, 0, stdDev};
+
+    Span<BollingerBands> view;
+    if (columns && columns->bands(key, columnOffset, candles.size(), view)) {
+        return view;
+    }
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto it = bandCache.find(key);
+    if (it == bandCache.end()) {
+        it = bandCache.emplace(key,
+            TechnicalIndicators::BollingerBandVector(closes, period, stdDev)).first;
+    }
+    return Span<BollingerBands>(it->second);
+}
+
+const MACDResult& IndicatorContext::macd(int fastPeriod, int slowPeriod,
+                                         int signalPeriod) const {
+    IndicatorKey key{IndicatorType::MACD, fastPeriod, slowPeriod, signalPeriod};
+
+    if (columns) {
+        const MACDResult* result = columns->macd(key, columnOffset, candles.size());
+        if (result) return *result;
+    }
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto it = macdCache.find(key);
+    if (it == macdCache.end()) {
+        it = macdCache.emplace(key,
+            TechnicalIndicators::MACD(closes, fastPeriod, slowPeriod, signalPeriod)).first;
+    }
+    return it->second;
+}
+
+void IndicatorContext::preload(const IndicatorKey& key, std::vector<double> values) {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    seriesCache[key] = std::move(values);
+}
+
+void IndicatorContext::preloadBands(const IndicatorKey& key, std::vector<BollingerBands> bands) {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    bandCache[key] = std::move(bands);
+}
+
+// ============================================================================
+// IndicatorCache
+// ============================================================================
+
+std::shared_ptr<const IndicatorContext> IndicatorCache::getContext(
+    const std::string& code, int timeframe, const std::vector<OHLCV>& candles) {
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+
+    auto key = std::make_pair(code, timeframe);
+    auto it = contexts.find(key);
+
+    // 무효화 누락 대비: 봉 개수와 마지막 봉 시각이 같을 때만 재사용
+    if (it != contexts.end()) {
+        const auto& ctx = it->second;
+        long long lastTime = candles.empty() ? 0 : candles.back().timestamp;
+        if (ctx->getCandles().size() == candles.size() &&
+            ctx->getLastBarTime() == lastTime) {
+            return ctx;
+        }
+    }
+
+    auto ctx = std::make_shared<const IndicatorContext>(code, timeframe, candles);
+    contexts[key] = ctx;
+    return ctx;
+}
+
+void IndicatorCache::publish(std::shared_ptr<const IndicatorContext> ctx) {
+    if (!ctx) return;
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    contexts[std::make_pair(ctx->getCode(), ctx->getTimeframe())] = std::move(ctx);
+}
+
+void IndicatorCache::invalidate(const std::string& code, int timeframe) {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    contexts.erase(std::make_pair(code, timeframe));
+}
+
+void IndicatorCache::clear() {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    contexts.clear();
+}
+
+size_t IndicatorCache::size() const {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    return contexts.size();
+}
+
+} // namespace yuanta
@@ -22,7 +22,7 @@ static double mean(const std::vector<double>& data, size_t start, size_t count)
 // SMA (Simple Moving Average)
 // ============================================================================
 
-double TechnicalIndicators::SMA(const std::vector<double>& prices, int period) {
+double TechnicalIndicators::SMA(Span<double> prices, int period) {
     if (prices.size() < static_cast<size_t>(period)) {
         throw std::invalid_argument("Not enough data for SMA calculation");
     }
@@ -34,7 +34,7 @@ double TechnicalIndicators::SMA(const std::vector<double>& prices, int period) {
     return sum / period;
 }
 
-std::vector<double> TechnicalIndicators::SMAVector(const std::vector<double>& prices, int period) {
+std::vector<double> TechnicalIndicators::SMAVector(Span<double> prices, int period) {
     std::vector<double> result;
     if (prices.size() < static_cast<size_t>(period)) return result;
 
@@ -56,13 +56,13 @@ std::vector<double> TechnicalIndicators::SMAVector(const std::vector<double>& pr
 // EMA (Exponential Moving Average)
 // ============================================================================
 
-double TechnicalIndicators::EMA(const std::vector<double>& prices, int period) {
+double TechnicalIndicators::EMA(Span<double> prices, int period) {
     if (prices.size() < static_cast<size_t>(period)) {
         throw std::invalid_argument("Not enough data for EMA calculation");
     }
 
     double multiplier = 2.0 / (period + 1);
-    double ema = SMA(std::vector<double>(prices.begin(), prices.begin() + period), period);
+    double ema = SMA(prices.first(period), period);
 
     for (size_t i = period; i < prices.size(); ++i) {
         ema = (prices[i] - ema) * multiplier + ema;
@@ -71,7 +71,7 @@ double TechnicalIndicators::EMA(const std::vector<double>& prices, int period) {
     return ema;
 }
 
-std::vector<double> TechnicalIndicators::EMAVector(const std::vector<double>& prices, int period) {
+std::vector<double> TechnicalIndicators::EMAVector(Span<double> prices, int period) {
     std::vector<double> result;
     if (prices.size() < static_cast<size_t>(period)) return result;
 
@@ -97,7 +97,7 @@ std::vector<double> TechnicalIndicators::EMAVector(const std::vector<double>& pr
 // WMA (Weighted Moving Average)
 // ============================================================================
 
-double TechnicalIndicators::WMA(const std::vector<double>& prices, int period) {
+double TechnicalIndicators::WMA(Span<double> prices, int period) {
     if (prices.size() < static_cast<size_t>(period)) {
         throw std::invalid_argument("Not enough data for WMA calculation");
     }
@@ -118,7 +118,7 @@ double TechnicalIndicators::WMA(const std::vector<double>& prices, int period) {
 // VWAP (Volume Weighted Average Price)
 // ============================================================================
 
-double TechnicalIndicators::VWAP(const std::vector<OHLCV>& candles) {
+double TechnicalIndicators::VWAP(Span<OHLCV> candles) {
     if (candles.empty()) return 0.0;
 
     double cumulativeTPV = 0.0;  // TP * Volume
@@ -134,7 +134,7 @@ double TechnicalIndicators::VWAP(const std::vector<OHLCV>& candles) {
     return cumulativeTPV / cumulativeVolume;
 }
 
-std::vector<double> TechnicalIndicators::VWAPVector(const std::vector<OHLCV>& candles) {
+std::vector<double> TechnicalIndicators::VWAPVector(Span<OHLCV> candles) {
     std::vector<double> result;
     if (candles.empty()) return result;
 
@@ -160,7 +160,7 @@ std::vector<double> TechnicalIndicators::VWAPVector(const std::vector<OHLCV>& ca
 // RSI (Relative Strength Index)
 // ============================================================================
 
-double TechnicalIndicators::RSI(const std::vector<double>& prices, int period) {
+double TechnicalIndicators::RSI(Span<double> prices, int period) {
     if (prices.size() < static_cast<size_t>(period) + 1) {
         throw std::invalid_argument("Not enough data for RSI calculation");
     }
@@ -198,7 +198,7 @@ double TechnicalIndicators::RSI(const std::vector<double>& prices, int period) {
     return 100.0 - (100.0 / (1.0 + rs));
 }
 
-std::vector<double> TechnicalIndicators::RSIVector(const std::vector<double>& prices, int period) {
+std::vector<double> TechnicalIndicators::RSIVector(Span<double> prices, int period) {
     std::vector<double> result;
     if (prices.size() < static_cast<size_t>(period) + 1) return result;
 
@@ -249,7 +249,7 @@ std::vector<double> TechnicalIndicators::RSIVector(const std::vector<double>& pr
 // MACD
 // ============================================================================
 
-MACDResult TechnicalIndicators::MACD(const std::vector<double>& prices,
+MACDResult TechnicalIndicators::MACD(Span<double> prices,
                                       int fastPeriod, int slowPeriod, int signalPeriod) {
     MACDResult result = {0, 0, 0, false, false};
 
@@ -292,7 +292,7 @@ MACDResult TechnicalIndicators::MACD(const std::vector<double>& prices,
     return result;
 }
 
-std::vector<MACDResult> TechnicalIndicators::MACDVector(const std::vector<double>& prices,
+std::vector<MACDResult> TechnicalIndicators::MACDVector(Span<double> prices,
                                                          int fastPeriod, int slowPeriod,
                                                          int signalPeriod) {
     std::vector<MACDResult> results;
@@ -340,7 +340,7 @@ std::vector<MACDResult> TechnicalIndicators::MACDVector(const std::vector<double
 // Bollinger Bands
 // ============================================================================
 
-double TechnicalIndicators::StdDev(const std::vector<double>& prices, int period) {
+double TechnicalIndicators::StdDev(Span<double> prices, int period) {
     if (prices.size() < static_cast<size_t>(period)) {
         throw std::invalid_argument("Not enough data for StdDev calculation");
     }
@@ -356,7 +356,7 @@ double TechnicalIndicators::StdDev(const std::vector<double>& prices, int period
     return std::sqrt(sumSq / period);
 }
 
-BollingerBands TechnicalIndicators::BollingerBand(const std::vector<double>& prices,
+BollingerBands TechnicalIndicators::BollingerBand(Span<double> prices,
                                                    int period, double stdDev) {
     BollingerBands bb = {0, 0, 0, 0, 0};
 
@@ -380,14 +380,13 @@ BollingerBands TechnicalIndicators::BollingerBand(const std::vector<double>& pri
 }
 
 std::vector<BollingerBands> TechnicalIndicators::BollingerBandVector(
-    const std::vector<double>& prices, int period, double stdDev) {
+    Span<double> prices, int period, double stdDev) {
 
     std::vector<BollingerBands> results;
     if (prices.size() < static_cast<size_t>(period)) return results;
 
     for (size_t i = period; i <= prices.size(); ++i) {
-        std::vector<double> window(prices.begin() + i - period, prices.begin() + i);
-        BollingerBands bb = BollingerBand(window, period, stdDev);
+        BollingerBands bb = BollingerBand(prices.subspan(i - period, period), period, stdDev);
         results.push_back(bb);
     }
 
@@ -405,7 +404,7 @@ double TechnicalIndicators::TrueRange(const OHLCV& current, const OHLCV& previou
     return (std::max)({hl, hpc, lpc});
 }
 
-double TechnicalIndicators::ATR(const std::vector<OHLCV>& candles, int period) {
+double TechnicalIndicators::ATR(Span<OHLCV> candles, int period) {
     if (candles.size() < static_cast<size_t>(period) + 1) {
         throw std::invalid_argument("Not enough data for ATR calculation");
     }
@@ -430,7 +429,7 @@ double TechnicalIndicators::ATR(const std::vector<OHLCV>& candles, int period) {
     return atr;
 }
 
-std::vector<double> TechnicalIndicators::ATRVector(const std::vector<OHLCV>& candles, int period) {
+std::vector<double> TechnicalIndicators::ATRVector(Span<OHLCV> candles, int period) {
     std::vector<double> result;
     if (candles.size() < static_cast<size_t>(period) + 1) return result;
 
@@ -458,7 +457,7 @@ std::vector<double> TechnicalIndicators::ATRVector(const std::vector<OHLCV>& can
 // 유틸리티 함수들
 // ============================================================================
 
-bool TechnicalIndicators::isMAAligned(const std::vector<double>& maValues) {
+bool TechnicalIndicators::isMAAligned(Span<double> maValues) {
     if (maValues.size() < 2) return false;
 
     for (size_t i = 0; i < maValues.size() - 1; ++i) {
@@ -469,7 +468,7 @@ bool TechnicalIndicators::isMAAligned(const std::vector<double>& maValues) {
     return true;
 }
 
-bool TechnicalIndicators::isBollingerSqueeze(const std::vector<BollingerBands>& bands,
+bool TechnicalIndicators::isBollingerSqueeze(Span<BollingerBands> bands,
                                               int lookback, double percentile) {
     if (bands.size() < static_cast<size_t>(lookback)) return false;
 
@@ -486,7 +485,7 @@ bool TechnicalIndicators::isBollingerSqueeze(const std::vector<BollingerBands>&
     return currentBandwidth <= bandwidths[percentileIdx];
 }
 
-double TechnicalIndicators::Highest(const std::vector<double>& prices, int period) {
+double TechnicalIndicators::Highest(Span<double> prices, int period) {
     if (prices.size() < static_cast<size_t>(period)) {
         return prices.empty() ? 0.0 : *std::max_element(prices.begin(), prices.end());
     }
@@ -494,7 +493,7 @@ double TechnicalIndicators::Highest(const std::vector<double>& prices, int perio
     return *std::max_element(prices.end() - period, prices.end());
 }
 
-double TechnicalIndicators::Lowest(const std::vector<double>& prices, int period) {
+double TechnicalIndicators::Lowest(Span<double> prices, int period) {
     if (prices.size() < static_cast<size_t>(period)) {
         return prices.empty() ? 0.0 : *std::min_element(prices.begin(), prices.end());
     }
@@ -502,7 +501,7 @@ double TechnicalIndicators::Lowest(const std::vector<double>& prices, int period
     return *std::min_element(prices.end() - period, prices.end());
 }
 
-double TechnicalIndicators::ROC(const std::vector<double>& prices, int period) {
+double TechnicalIndicators::ROC(Span<double> prices, int period) {
     if (prices.size() < static_cast<size_t>(period) + 1) {
         return 0.0;
     }
@@ -514,7 +513,7 @@ double TechnicalIndicators::ROC(const std::vector<double>& prices, int period) {
     return ((current - past) / past) * 100.0;
 }
 
-double TechnicalIndicators::Momentum(const std::vector<double>& prices, int period) {
+double TechnicalIndicators::Momentum(Span<double> prices, int period) {
     if (prices.size() < static_cast<size_t>(period) + 1) {
         return 0.0;
     }
@@ -523,7 +522,7 @@ double TechnicalIndicators::Momentum(const std::vector<double>& prices, int peri
 }
 
 TechnicalIndicators::Stochastic TechnicalIndicators::StochasticOscillator(
-    const std::vector<OHLCV>& candles, int kPeriod, int dPeriod) {
+    Span<OHLCV> candles, int kPeriod, int dPeriod) {
 
     Stochastic result = {50.0, 50.0};
 
@@ -565,98 +564,354 @@ TechnicalIndicators::Stochastic TechnicalIndicators::StochasticOscillator(
 // StreamingIndicators
 // ============================================================================
 
+void StreamingIndicators::EMAState::update(double x) {
+    if (count < period) {
+        seedSum += x;
+        if (++count == period) {
+            value = seedSum / period;  // 첫 EMA는 SMA로 시작
+        }
+    } else {
+        value = (x - value) * multiplier + value;
+    }
+}
+
+void StreamingIndicators::RSIState::update(double price) {
+    if (!hasPrev) {
+        prevPrice = price;
+        hasPrev = true;
+        return;
+    }
+
+    double change = price - prevPrice;
+    double gain = change > 0 ? change : 0.0;
+    double loss = change > 0 ? 0.0 : -change;
+    prevPrice = price;
+
+    if (count < period) {
+        avgGain += gain;
+        avgLoss += loss;
+        if (++count == period) {
+            avgGain /= period;
+            avgLoss /= period;
+        }
+    } else {
+        avgGain = (avgGain * (period - 1) + gain) / period;
+        avgLoss = (avgLoss * (period - 1) + loss) / period;
+    }
+}
+
+double StreamingIndicators::RSIState::value() const {
+    if (count < period) return 50.0;
+    if (avgLoss == 0) return 100.0;
+    double rs = avgGain / avgLoss;
+    return 100.0 - (100.0 / (1.0 + rs));
+}
+
+void StreamingIndicators::MACDState::update(double price) {
+    fast.update(price);
+    slow.update(price);
+    if (!slow.ready() || !fast.ready()) return;
+
+    // 크로스 판정용 직전 값 보관
+    if (signal.ready()) {
+        prevMACD = macd;
+        prevSignal = signal.value;
+    }
+
+    macd = fast.value - slow.value;
+    signal.update(macd);
+    ++signalCount;
+}
+
+MACDResult StreamingIndicators::MACDState::value() const {
+    MACDResult result = {0, 0, 0, false, false};
+    if (!signal.ready()) return result;
+
+    result.macd = macd;
+    result.signal = signal.value;
+    result.histogram = result.macd - result.signal;
+
+    // 시그널 값이 2개 이상일 때만 크로스 체크
+    if (signalCount > signal.period) {
+        result.bullishCross = (prevMACD < prevSignal) && (result.macd > result.signal);
+        result.bearishCross = (prevMACD > prevSignal) && (result.macd < result.signal);
+    }
+
+    return result;
+}
+
+void StreamingIndicators::ATRState::update(const OHLCV& candle) {
+    if (!hasPrev) {
+        prevClose = candle.close;
+        hasPrev = true;
+        return;
+    }
+
+    double hl = candle.high - candle.low;
+    double hpc = std::abs(candle.high - prevClose);
+    double lpc = std::abs(candle.low - prevClose);
+    double tr = (std::max)({hl, hpc, lpc});
+    prevClose = candle.close;
+
+    if (count < period) {
+        atr += tr;
+        if (++count == period) {
+            atr /= period;
+        }
+    } else {
+        atr = (atr * (period - 1) + tr) / period;
+    }
+}
+
 StreamingIndicators::StreamingIndicators() {}
 
-void StreamingIndicators::addPrice(double price, long long volume) {
-    prices.push_back(price);
-    if (volume > 0) volumes.push_back(static_cast<double>(volume));
+// 등록: 이미 있으면 무시, 없으면 쌓인 이력으로 상태를 만들어 둠
+void StreamingIndicators::registerSMA(int period) {
+    if (period <= 0 || findWindow(period)) return;
 
-    if (prices.size() > maxSize) {
-        prices.pop_front();
+    WindowState w{period};
+    size_t count = (std::min)(static_cast<size_t>(period), prices.size());
+    for (size_t i = prices.size() - count; i < prices.size(); ++i) {
+        w.sum += prices[i];
+        w.sumSq += prices[i] * prices[i];
     }
-    if (volumes.size() > maxSize) {
-        volumes.pop_front();
+    windows.push_back(w);
+}
+
+void StreamingIndicators::registerEMA(int period) {
+    if (period <= 0 || findEMA(period)) return;
+
+    EMAState e(period);
+    for (double p : prices) e.update(p);
+    emas.push_back(e);
+}
+
+void StreamingIndicators::registerRSI(int period) {
+    if (period <= 0 || findRSI(period)) return;
+
+    RSIState r{period};
+    for (double p : prices) r.update(p);
+    rsis.push_back(r);
+}
+
+void StreamingIndicators::registerMACD(int fastPeriod, int slowPeriod, int signalPeriod) {
+    if (fastPeriod <= 0 || slowPeriod <= 0 || signalPeriod <= 0 ||
+        findMACD(fastPeriod, slowPeriod, signalPeriod)) {
+        return;
     }
 
-    // EMA 캐시 무효화
-    emaCache.clear();
-    rsiCache.clear();
+    MACDState m(fastPeriod, slowPeriod, signalPeriod);
+    for (double p : prices) m.update(p);
+    macds.push_back(m);
+}
+
+void StreamingIndicators::registerBB(int period) {
+    registerSMA(period);
+}
+
+void StreamingIndicators::registerATR(int period) {
+    if (period <= 0 || findATR(period)) return;
+
+    ATRState a{period};
+    for (const auto& c : candles) a.update(c);
+    atrs.push_back(a);
+}
+
+void StreamingIndicators::addPrice(double price, long long /*volume*/) {
+    updatePriceStates(price);
 }
 
 void StreamingIndicators::addOHLCV(const OHLCV& candle) {
     candles.push_back(candle);
+    double typicalPrice = (candle.high + candle.low + candle.close) / 3.0;
+    windowTPV += typicalPrice * candle.volume;
+    windowVolume += candle.volume;
+
+    for (auto& a : atrs) a.update(candle);
+
     if (candles.size() > maxSize) {
+        const OHLCV& old = candles.front();
+        double oldTP = (old.high + old.low + old.close) / 3.0;
+        windowTPV -= oldTP * old.volume;
+        windowVolume -= old.volume;
         candles.pop_front();
     }
 
-    addPrice(candle.close, candle.volume);
+    updatePriceStates(candle.close);
 }
 
-double StreamingIndicators::getCurrentSMA(int period) const {
-    std::vector<double> priceVec(prices.begin(), prices.end());
-    if (priceVec.size() < static_cast<size_t>(period)) return 0.0;
-    return TechnicalIndicators::SMA(priceVec, period);
+void StreamingIndicators::updatePriceStates(double price) {
+    prices.push_back(price);
+    size_t n = prices.size();
+
+    for (auto& w : windows) {
+        w.sum += price;
+        w.sumSq += price * price;
+        if (n > static_cast<size_t>(w.period)) {
+            double old = prices[n - 1 - w.period];
+            w.sum -= old;
+            w.sumSq -= old * old;
+        }
+    }
+    for (auto& e : emas) e.update(price);
+    for (auto& r : rsis) r.update(price);
+    for (auto& m : macds) m.update(price);
+
+    if (prices.size() > maxSize) {
+        prices.pop_front();
+    }
+
+    // 누적 합의 부동소수점 오차 제거 (maxSize 틱마다 재계산, 분할상환 O(1))
+    if (++updatesSinceRebuild >= maxSize) {
+        rebuildWindows();
+    }
 }
 
-double StreamingIndicators::getCurrentEMA(int period) const {
-    auto it = emaCache.find(period);
-    if (it != emaCache.end()) return it->second;
+void StreamingIndicators::rebuildWindows() {
+    for (auto& w : windows) {
+        size_t count = (std::min)(static_cast<size_t>(w.period), prices.size());
+        w.sum = 0.0;
+        w.sumSq = 0.0;
+        for (size_t i = prices.size() - count; i < prices.size(); ++i) {
+            w.sum += prices[i];
+            w.sumSq += prices[i] * prices[i];
+        }
+    }
 
-    std::vector<double> priceVec(prices.begin(), prices.end());
-    if (priceVec.size() < static_cast<size_t>(period)) return 0.0;
+    windowTPV = 0.0;
+    windowVolume = 0.0;
+    for (const auto& c : candles) {
+        windowTPV += (c.high + c.low + c.close) / 3.0 * c.volume;
+        windowVolume += c.volume;
+    }
 
-    double ema = TechnicalIndicators::EMA(priceVec, period);
-    emaCache[period] = ema;
-    return ema;
+    updatesSinceRebuild = 0;
 }
 
-double StreamingIndicators::getCurrentRSI(int period) const {
-    auto it = rsiCache.find(period);
-    if (it != rsiCache.end()) return it->second;
+const StreamingIndicators::WindowState* StreamingIndicators::findWindow(int period) const {
+    for (const auto& w : windows) {
+        if (w.period == period) return &w;
+    }
+    return nullptr;
+}
+
+const StreamingIndicators::EMAState* StreamingIndicators::findEMA(int period) const {
+    for (const auto& e : emas) {
+        if (e.period == period) return &e;
+    }
+    return nullptr;
+}
+
+const StreamingIndicators::RSIState* StreamingIndicators::findRSI(int period) const {
+    for (const auto& r : rsis) {
+        if (r.period == period) return &r;
+    }
+    return nullptr;
+}
+
+const StreamingIndicators::MACDState* StreamingIndicators::findMACD(int fastPeriod,
+                                                                    int slowPeriod,
+                                                                    int signalPeriod) const {
+    for (const auto& m : macds) {
+        if (m.fast.period == fastPeriod && m.slow.period == slowPeriod &&
+            m.signal.period == signalPeriod) {
+            return &m;
+        }
+    }
+    return nullptr;
+}
 
-    std::vector<double> priceVec(prices.begin(), prices.end());
-    if (priceVec.size() < static_cast<size_t>(period) + 1) return 50.0;
+const StreamingIndicators::ATRState* StreamingIndicators::findATR(int period) const {
+    for (const auto& a : atrs) {
+        if (a.period == period) return &a;
+    }
+    return nullptr;
+}
 
-    double rsi = TechnicalIndicators::RSI(priceVec, period);
-    rsiCache[period] = rsi;
-    return rsi;
+double StreamingIndicators::getCurrentSMA(int period) const {
+    const WindowState* w = findWindow(period);
+    if (!w || prices.size() < static_cast<size_t>(period)) return 0.0;
+    return w->sum / period;
+}
+
+double StreamingIndicators::getCurrentEMA(int period) const {
+    const EMAState* e = findEMA(period);
+    return e && e->ready() ? e->value : 0.0;
+}
+
+double StreamingIndicators::getCurrentRSI(int period) const {
+    const RSIState* r = findRSI(period);
+    return r ? r->value() : 50.0;
 }
 
 double StreamingIndicators::getCurrentVWAP() const {
-    std::vector<OHLCV> candleVec(candles.begin(), candles.end());
-    if (candleVec.empty()) return 0.0;
-    return TechnicalIndicators::VWAP(candleVec);
+    if (candles.empty() || windowVolume == 0) return 0.0;
+    return windowTPV / windowVolume;
 }
 
 MACDResult StreamingIndicators::getCurrentMACD() const {
-    std::vector<double> priceVec(prices.begin(), prices.end());
-    return TechnicalIndicators::MACD(priceVec);
+    return getCurrentMACD(12, 26, 9);
+}
+
+MACDResult StreamingIndicators::getCurrentMACD(int fastPeriod, int slowPeriod,
+                                               int signalPeriod) const {
+    const MACDState* m = findMACD(fastPeriod, slowPeriod, signalPeriod);
+    if (!m) return MACDResult{0, 0, 0, false, false};
+    return m->value();
 }
 
 BollingerBands StreamingIndicators::getCurrentBB(int period, double stdDev) const {
-    std::vector<double> priceVec(prices.begin(), prices.end());
-    if (priceVec.size() < static_cast<size_t>(period)) {
-        return {0, 0, 0, 0, 0};
+    BollingerBands bb = {0, 0, 0, 0, 0};
+    const WindowState* w = findWindow(period);
+    if (!w || prices.size() < static_cast<size_t>(period)) return bb;
+
+    double mean = w->sum / period;
+    double variance = (std::max)(0.0, w->sumSq / period - mean * mean);
+    double sd = std::sqrt(variance);
+
+    bb.middle = mean;
+    bb.upper = mean + sd * stdDev;
+    bb.lower = mean - sd * stdDev;
+    bb.bandwidth = (bb.upper - bb.lower) / bb.middle;
+
+    if (bb.upper != bb.lower) {
+        bb.percentB = (prices.back() - bb.lower) / (bb.upper - bb.lower);
     }
-    return TechnicalIndicators::BollingerBand(priceVec, period, stdDev);
+
+    return bb;
 }
 
 double StreamingIndicators::getCurrentATR(int period) const {
-    std::vector<OHLCV> candleVec(candles.begin(), candles.end());
-    if (candleVec.size() < static_cast<size_t>(period) + 1) return 0.0;
-    return TechnicalIndicators::ATR(candleVec, period);
+    const ATRState* a = findATR(period);
+    return a && a->count >= a->period ? a->atr : 0.0;
 }
 
 void StreamingIndicators::clear() {
     prices.clear();
     candles.clear();
-    volumes.clear();
-    emaCache.clear();
-    rsiCache.clear();
+    windowTPV = 0.0;
+    windowVolume = 0.0;
+    updatesSinceRebuild = 0;
+
+    // 등록된 지표는 유지하고 상태만 초기화
+    for (auto& w : windows) w = WindowState{w.period};
+    for (auto& e : emas) e = EMAState(e.period);
+    for (auto& r : rsis) r = RSIState{r.period};
+    for (auto& m : macds) m = MACDState(m.fast.period, m.slow.period, m.signal.period);
+    for (auto& a : atrs) a = ATRState{a.period};
 }
 
 void StreamingIndicators::setMaxSize(size_t size) {
     maxSize = size;
+
+    while (prices.size() > maxSize) {
+        prices.pop_front();
+    }
+    while (candles.size() > maxSize) {
+        candles.pop_front();
+    }
+
+    rebuildWindows();
 }
 
 } // namespace yuanta
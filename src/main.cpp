@@ -5,6 +5,7 @@
 #include "../include/OrderExecutor.h"
 #include "../include/TechnicalIndicators.h"
 #include "../include/WebServer.h"
+#include "../include/StrategyEvaluator.h"
 
 #include <iostream>
 #include <fstream>
@@ -16,6 +17,9 @@
 
 #include <sstream>
 #include <map>
+#include <mutex>
+#include <vector>
+#include <algorithm>
 
 using namespace yuanta;
 
@@ -166,30 +170,16 @@ void updateDashboard(WebServer& webServer, RiskManager& rm, StrategyManager& sm,
         data.quotes.push_back(q);
     }
 
-    // 전략 정보
-    DashboardData::StrategyStatus s1;
-    s1.name = "Gap Pullback";
-    s1.enabled = config.enableGapPullback;
-    s1.signals = 0;
-    s1.trades = 0;
-    s1.pnl = 0;
-    data.strategies.push_back(s1);
-
-    DashboardData::StrategyStatus s2;
-    s2.name = "MA Breakout";
-    s2.enabled = config.enableMABreakout;
-    s2.signals = 0;
-    s2.trades = 0;
-    s2.pnl = 0;
-    data.strategies.push_back(s2);
-
-    DashboardData::StrategyStatus s3;
-    s3.name = "BB Squeeze";
-    s3.enabled = config.enableBBSqueeze;
-    s3.signals = 0;
-    s3.trades = 0;
-    s3.pnl = 0;
-    data.strategies.push_back(s3);
+    // 전략 정보 (평가 스레드가 갱신하는 상태의 복사본)
+    for (const auto& status : sm.getStatusSnapshot()) {
+        DashboardData::StrategyStatus s;
+        s.name = status.name;
+        s.enabled = status.enabled;
+        s.signals = static_cast<int>(status.signalCount);
+        s.trades = 0;
+        s.pnl = 0;
+        data.strategies.push_back(s);
+    }
 
     webServer.updateDashboardData(data);
 }
@@ -203,6 +193,15 @@ void printStatus(RiskManager& rm, StrategyManager& sm) {
     std::cout << "Open Positions: " << rm.getOpenPositionCount() << std::endl;
     std::cout << "Win Rate: " << std::setprecision(1) << rm.getWinRate() << "%" << std::endl;
 
+    for (const auto& status : sm.getStatusSnapshot()) {
+        std::cout << "Strategy " << status.name << ": " << (status.enabled ? "ON" : "OFF")
+                  << ", signals " << status.signalCount;
+        if (!status.lastSignalCode.empty()) {
+            std::cout << " (last " << status.lastSignalCode << ": " << status.lastSignalReason << ")";
+        }
+        std::cout << std::endl;
+    }
+
     if (rm.isDailyLossLimitReached()) {
         std::cout << "*** DAILY LOSS LIMIT REACHED - Trading Stopped ***" << std::endl;
     }
@@ -289,11 +288,20 @@ int main(int argc, char* argv[]) {
     MarketDataManager dataManager;
     dataManager.setAPI(&api);
 
+    // 바이너리 분봉 파일이 있으면 API 조회 대신 사용
+    BarFileReader historyFile;
+    bool hasHistoryFile = historyFile.open("data/history_1m.ybar");
+
     std::cout << "Loading market data for watchlist:" << std::endl;
     for (const auto& code : config.watchlist) {
-        std::cout << "  - " << code;
         dataManager.addWatchlist(code);
-        dataManager.loadHistoricalData(code, 60);
+    }
+
+    // 종목별 과거 데이터는 병렬로 조회/적재
+    dataManager.warmUpHistory(config.watchlist, 60, hasHistoryFile ? &historyFile : nullptr);
+
+    for (const auto& code : config.watchlist) {
+        std::cout << "  - " << code;
         auto dailyCandles = dataManager.getDailyCandles(code, 60);
         auto minuteCandles = dataManager.getMinuteCandles(code, 1, 100);
 
@@ -335,14 +343,103 @@ int main(int argc, char* argv[]) {
     stopLossMonitor.setRiskManager(&riskManager);
     stopLossMonitor.start();
 
+    // 7. 웹 대시보드 생성
+    WebServer webServer(config.webPort);
+    g_webServer = &webServer;
+
+    // 8. 전략 평가 스테이지 (새 데이터가 들어온 종목만 평가)
+    StrategyEvaluator strategyEvaluator;
+    std::vector<OHLCV> evalCandles;     // 평가 스레드 전용 버퍼 (재사용)
+
+    // 1분봉이 마감된 종목 (수집 스레드가 쌓고 평가 스레드가 가져감)
+    std::mutex closedBarMutex;
+    std::vector<std::string> closedBarCodes;
+    std::vector<std::string> batchCodes;
+    std::vector<std::vector<OHLCV>> batchCandles;
+
+    strategyEvaluator.setHandler([&](const std::string& code) {
+        batchCodes.clear();
+        {
+            std::lock_guard<std::mutex> lock(closedBarMutex);
+            batchCodes.swap(closedBarCodes);
+        }
+
+        if (!tradingActive) return;
+
+        // 같은 분에 마감된 종목들의 지표를 한 번에 계산해 캐시에 게시
+        // (이어지는 각 종목 평가는 봉 구성이 같으면 게시된 컨텍스트를 그대로 씀)
+        if (!batchCodes.empty()) {
+            std::sort(batchCodes.begin(), batchCodes.end());
+            batchCodes.erase(std::unique(batchCodes.begin(), batchCodes.end()), batchCodes.end());
+            batchCandles.resize(batchCodes.size());
+            for (size_t i = 0; i < batchCodes.size(); ++i) {
+                dataManager.getMinuteCandles(batchCodes[i], 1, 100, batchCandles[i]);
+            }
+            strategyManager.precomputeIndicators(batchCodes, batchCandles);
+        }
+        if (!api.isSimulationMode() && !dataManager.isMarketOpen()) return;
+        if (riskManager.isDailyLossLimitReached()) return;
+
+        dataManager.getMinuteCandles(code, 1, 100, evalCandles);
+        auto quote = dataManager.getQuote(code);
+
+        if (evalCandles.empty()) return;
+
+        // 전략 분석
+        auto signals = strategyManager.analyzeAll(code, evalCandles, quote);
+
+        // 신호 처리
+        for (const auto& signal : signals) {
+            if (signal.signal == Signal::BUY) {
+                int qty = riskManager.calculatePositionSize(signal.price);
+                if (riskManager.canOpenPosition(code, signal.price, qty)) {
+                    std::cout << "[" << code << "] BUY SIGNAL @ "
+                              << std::fixed << std::setprecision(0) << signal.price
+                              << " (" << signal.reason << ")" << std::endl;
+
+                    webServer.addLog("SIGNAL", code, signal.reason, signal.price, qty, 0);
+
+                    if (api.isSimulationMode()) {
+                        std::cout << "  -> Simulated buy: " << qty << " shares" << std::endl;
+                    }
+                    orderExecutor.executeSignal(signal);
+                    webServer.addLog("BUY", code, "Order executed", signal.price, qty, 0);
+                }
+            }
+        }
+
+        // 청산 조건 확인
+        std::map<std::string, QuoteData> quotes;
+        quotes[code] = quote;
+
+        auto closeSignals = strategyManager.checkCloseConditions(
+            riskManager.getAllPositions(), quotes);
+
+        for (const auto& closeSignal : closeSignals) {
+            std::cout << "[" << closeSignal.code << "] CLOSE SIGNAL" << std::endl;
+            webServer.addLog("SELL", closeSignal.code, "Position closed", closeSignal.price, 0, 0);
+            orderExecutor.executeSignal(closeSignal);
+        }
+    });
+
     dataManager.setQuoteUpdateCallback([&](const std::string& code, const QuoteData& quote) {
         stopLossMonitor.onQuoteUpdate(code, quote);
+        strategyEvaluator.notify(quote.symbolId);
     });
 
-    // 7. 웹 대시보드 시작
-    WebServer webServer(config.webPort);
-    g_webServer = &webServer;
+    // 분봉 완성 시 공유 지표 캐시 무효화 후 재평가 (1분봉은 다음 평가 전에 일괄 재계산)
+    dataManager.setCandleCompleteCallback([&](const std::string& code, int minutes, const OHLCV&) {
+        strategyManager.onCandleComplete(code, minutes);
+        if (minutes == 1) {
+            std::lock_guard<std::mutex> lock(closedBarMutex);
+            closedBarCodes.push_back(code);
+        }
+        strategyEvaluator.notify(code);
+    });
 
+    strategyEvaluator.start();
+
+    // 9. 웹 대시보드 시작
     // 명령 콜백 설정
     webServer.setCommandCallback([&](const std::string& cmd) {
         if (cmd == "START") {
@@ -350,6 +447,10 @@ int main(int argc, char* argv[]) {
             webServer.setTradingActive(true);
             std::cout << "\n*** 매매 시작! ***\n" << std::endl;
             webServer.addLog("INFO", "", "Trading started", 0, 0, 0);
+            // 다음 시세를 기다리지 않고 전 종목 1회 평가
+            for (const auto& code : config.watchlist) {
+                strategyEvaluator.notify(code);
+            }
         } else if (cmd == "STOP") {
             tradingActive = false;
             webServer.setTradingActive(false);
@@ -373,7 +474,7 @@ int main(int argc, char* argv[]) {
         webServer.addLog("INFO", "", "System started - Press START to begin trading", 0, 0, 0);
     }
 
-    // 8. 실시간 시세 시작
+    // 10. 실시간 시세 시작
     dataManager.startRealtime();
 
     std::cout << "========================================" << std::endl;
@@ -383,7 +484,7 @@ int main(int argc, char* argv[]) {
     }
     std::cout << "========================================\n" << std::endl;
 
-    // 9. 메인 루프
+    // 11. 메인 루프 (종목 분석은 StrategyEvaluator가 시세 이벤트마다 수행)
     int loopCount = 0;
     while (running) {
         // 명령 파일 체크
@@ -432,50 +533,6 @@ int main(int argc, char* argv[]) {
             continue;
         }
 
-        // 각 종목 분석
-        for (const auto& code : config.watchlist) {
-            auto candles = dataManager.getMinuteCandles(code, 1, 100);
-            auto quote = dataManager.getQuote(code);
-
-            if (candles.empty()) continue;
-
-            // 전략 분석
-            auto signals = strategyManager.analyzeAll(code, candles, quote);
-
-            // 신호 처리
-            for (const auto& signal : signals) {
-                if (signal.signal == Signal::BUY) {
-                    int qty = riskManager.calculatePositionSize(signal.price);
-                    if (riskManager.canOpenPosition(code, signal.price, qty)) {
-                        std::cout << "[" << code << "] BUY SIGNAL @ "
-                                  << std::fixed << std::setprecision(0) << signal.price
-                                  << " (" << signal.reason << ")" << std::endl;
-
-                        webServer.addLog("SIGNAL", code, signal.reason, signal.price, qty, 0);
-
-                        if (api.isSimulationMode()) {
-                            std::cout << "  -> Simulated buy: " << qty << " shares" << std::endl;
-                        }
-                        orderExecutor.executeSignal(signal);
-                        webServer.addLog("BUY", code, "Order executed", signal.price, qty, 0);
-                    }
-                }
-            }
-
-            // 청산 조건 확인
-            std::map<std::string, QuoteData> quotes;
-            quotes[code] = quote;
-
-            auto closeSignals = strategyManager.checkCloseConditions(
-                riskManager.getAllPositions(), quotes);
-
-            for (const auto& closeSignal : closeSignals) {
-                std::cout << "[" << closeSignal.code << "] CLOSE SIGNAL" << std::endl;
-                webServer.addLog("SELL", closeSignal.code, "Position closed", closeSignal.price, 0, 0);
-                orderExecutor.executeSignal(closeSignal);
-            }
-        }
-
         // 대시보드 업데이트 (2초마다)
         if (loopCount % 2 == 0) {
             updateDashboard(webServer, riskManager, strategyManager, dataManager, api, config, startTime);
@@ -484,17 +541,24 @@ int main(int argc, char* argv[]) {
         // 콘솔 상태 출력 (30초마다)
         if (++loopCount % 30 == 0) {
             printStatus(riskManager, strategyManager);
+
+            auto ingest = dataManager.getIngestStats();
+            std::cout << "Ingest: depth " << ingest.depth << "/" << ingest.capacity
+                      << " (max " << ingest.maxDepth << "), processed " << ingest.processed
+                      << ", dropped " << ingest.dropped
+                      << ", max latency " << ingest.maxLatencyUs << "us" << std::endl;
         }
 
         std::this_thread::sleep_for(std::chrono::seconds(1));
     }
 
-    // 10. 종료 처리
+    // 12. 종료 처리
     std::cout << "\nShutting down..." << std::endl;
     webServer.addLog("INFO", "", "System shutting down", 0, 0, 0);
 
-    orderExecutor.closeAllPositions();
     dataManager.stopRealtime();
+    strategyEvaluator.stop();
+    orderExecutor.closeAllPositions();
     stopLossMonitor.stop();
     orderExecutor.stop();
     webServer.stop();
@@ -1,17 +1,21 @@
 #include "../../include/Strategy.h"
 #include "../../include/TechnicalIndicators.h"
+#include "../../include/BatchIndicators.h"
+#include "../../include/Clock.h"
 #include <ctime>
 #include <algorithm>
+#include <set>
 
 namespace yuanta {
 
 BBSqueezeStrategy::BBSqueezeStrategy() {}
 
-SignalInfo BBSqueezeStrategy::analyze(const std::string& code,
-                                       const std::vector<OHLCV>& candles,
+SignalInfo BBSqueezeStrategy::analyze(const IndicatorContext& ctx,
                                        const QuoteData& quote) {
+    Span<OHLCV> candles = ctx.getCandles();
+
     SignalInfo signal;
-    signal.code = code;
+    signal.code = ctx.getCode();
     signal.signal = Signal::NONE;
 
     if (!enabled) return signal;
@@ -21,14 +25,8 @@ SignalInfo BBSqueezeStrategy::analyze(const std::string& code,
         return signal;
     }
 
-    // 종가 배열 추출
-    std::vector<double> closes;
-    for (const auto& candle : candles) {
-        closes.push_back(candle.close);
-    }
-
-    // 볼린저 밴드 계산
-    auto bbVector = TechnicalIndicators::BollingerBandVector(closes, bbPeriod, bbStdDev);
+    // 볼린저 밴드 (공유 캐시)
+    Span<BollingerBands> bbVector = ctx.bollinger(bbPeriod, bbStdDev);
 
     if (bbVector.size() < static_cast<size_t>(squeezeLookback)) {
         return signal;
@@ -62,13 +60,18 @@ SignalInfo BBSqueezeStrategy::analyze(const std::string& code,
     }
 
     // 4. RSI 확인 (55~75)
-    double rsi = TechnicalIndicators::RSI(closes, 14);
+    Span<double> rsiVector = ctx.rsi(14);
+    if (rsiVector.empty()) {
+        return signal;
+    }
+    double rsi = rsiVector.back();
     if (rsi < rsiMin || rsi > rsiMax) {
         return signal;
     }
 
-    // ATR 계산 (목표가 설정용)
-    double atr = TechnicalIndicators::ATR(candles, 14);
+    // ATR (목표가 설정용)
+    Span<double> atrVector = ctx.atr(14);
+    double atr = atrVector.empty() ? 0.0 : atrVector.back();
 
     // 모든 조건 충족 - 매수 신호
     signal.signal = Signal::BUY;
@@ -102,12 +105,7 @@ bool BBSqueezeStrategy::shouldClose(const Position& position,
     }
 
     // 시간 기반 청산 (14:30 이후)
-    auto now = std::chrono::system_clock::now();
-    std::time_t t = std::chrono::system_clock::to_time_t(now);
-    std::tm* tm = std::localtime(&t);
-    int minutes = tm->tm_hour * 60 + tm->tm_min;
-
-    if (minutes >= 870) {
+    if (currentClock().session().minuteOfDay >= SessionTime::TIME_STOP) {
         return true;
     }
 
@@ -137,7 +135,27 @@ double BBSqueezeStrategy::getParameter(const std::string& name) const {
     return 0.0;
 }
 
-bool BBSqueezeStrategy::checkSqueeze(const std::vector<BollingerBands>& bands) const {
+std::vector<std::string> BBSqueezeStrategy::parameterNames() const {
+    return {"bbPeriod", "bbStdDev", "squeezeLookback", "squeezePercentile",
+            "volumeMultiple", "rsiMin", "rsiMax", "stopLossPercent"};
+}
+
+size_t BBSqueezeStrategy::minimumBars() const {
+    // 밴드폭 squeezeLookback개를 모으려면 bbPeriod + squeezeLookback - 1봉, 거래량 확인에 20봉
+    size_t bands = static_cast<size_t>((std::max)(bbPeriod, 1)) +
+                   static_cast<size_t>((std::max)(squeezeLookback, 0)) - 1;
+    return (std::max)(bands, size_t(20));
+}
+
+std::vector<IndicatorKey> BBSqueezeStrategy::requiredIndicators() const {
+    return {
+        IndicatorKey{IndicatorType::BOLLINGER, bbPeriod, 0, 0, bbStdDev},
+        IndicatorKey{IndicatorType::RSI, 14},
+        IndicatorKey{IndicatorType::ATR, 14}
+    };
+}
+
+bool BBSqueezeStrategy::checkSqueeze(Span<BollingerBands> bands) const {
     if (bands.size() < static_cast<size_t>(squeezeLookback)) return false;
 
     // 최근 N개 밴드폭 수집
@@ -175,10 +193,22 @@ StrategyManager::StrategyManager() {}
 StrategyManager::~StrategyManager() {}
 
 void StrategyManager::addStrategy(std::unique_ptr<Strategy> strategy) {
+    std::lock_guard<std::mutex> lock(statusMutex);
+    StrategyStatus entry;
+    entry.name = strategy->getName();
+    status.push_back(entry);
     strategies.push_back(std::move(strategy));
 }
 
 void StrategyManager::removeStrategy(const std::string& name) {
+    std::lock_guard<std::mutex> lock(statusMutex);
+    status.erase(
+        std::remove_if(status.begin(), status.end(),
+            [&name](const StrategyStatus& s) {
+                return s.name == name;
+            }),
+        status.end()
+    );
     strategies.erase(
         std::remove_if(strategies.begin(), strategies.end(),
             [&name](const std::unique_ptr<Strategy>& s) {
@@ -199,14 +229,25 @@ Strategy* StrategyManager::getStrategy(const std::string& name) {
 
 std::vector<SignalInfo> StrategyManager::analyzeAll(const std::string& code,
                                                      const std::vector<OHLCV>& candles,
-                                                     const QuoteData& quote) {
+                                                     const QuoteData& quote,
+                                                     int timeframe) {
     std::vector<SignalInfo> signals;
 
-    for (auto& strategy : strategies) {
+    // 같은 봉에 대해서는 모든 전략이 하나의 지표 컨텍스트를 공유
+    auto ctx = indicatorCache.getContext(code, timeframe, candles);
+
+    for (size_t i = 0; i < strategies.size(); ++i) {
+        auto& strategy = strategies[i];
         if (strategy->isEnabled()) {
-            auto signal = strategy->analyze(code, candles, quote);
+            auto signal = strategy->analyze(*ctx, quote);
             if (signal.signal != Signal::NONE) {
+                signal.strategy = strategy->getName();
                 signals.push_back(signal);
+
+                std::lock_guard<std::mutex> lock(statusMutex);
+                status[i].signalCount++;
+                status[i].lastSignalCode = code;
+                status[i].lastSignalReason = signal.reason;
             }
         }
     }
@@ -251,8 +292,106 @@ std::vector<SignalInfo> StrategyManager::checkCloseConditions(
     return closeSignals;
 }
 
+void StrategyManager::onCandleComplete(const std::string& code, int timeframe) {
+    indicatorCache.invalidate(code, timeframe);
+}
+
+size_t StrategyManager::precomputeIndicators(const std::vector<std::string>& codes,
+                                             const std::vector<std::vector<OHLCV>>& candles,
+                                             int timeframe) {
+    size_t count = (std::min)(codes.size(), candles.size());
+
+    // 활성 전략이 요구하는 지표 중 일괄 커널이 있는 것만
+    std::set<IndicatorKey> keys;
+    for (const auto& strategy : strategies) {
+        if (!strategy->isEnabled()) continue;
+        for (const auto& key : strategy->requiredIndicators()) {
+            switch (key.type) {
+                case IndicatorType::SMA:
+                case IndicatorType::EMA:
+                case IndicatorType::RSI:
+                case IndicatorType::ATR:
+                case IndicatorType::BOLLINGER:
+                    if (key.param1 > 0) keys.insert(key);
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+    if (count == 0 || keys.empty()) return 0;
+
+    size_t numBars = 0;
+    for (size_t i = 0; i < count; ++i) {
+        numBars = (std::max)(numBars, candles[i].size());
+    }
+
+    // 짧은 종목은 앞쪽이 NaN으로 채워지고 커널은 종목별 첫 유효 봉부터 계산
+    CandleBlock block;
+    block.resize(count, numBars);
+    std::vector<std::shared_ptr<IndicatorContext>> contexts;
+    contexts.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        block.setSeries(i, candles[i]);
+        contexts.push_back(std::make_shared<IndicatorContext>(codes[i], timeframe, candles[i]));
+    }
+
+    std::vector<double> values;
+    BatchBands bands;
+    for (const auto& key : keys) {
+        switch (key.type) {
+            case IndicatorType::SMA: BatchIndicators::SMA(block, key.param1, values); break;
+            case IndicatorType::EMA: BatchIndicators::EMA(block, key.param1, values); break;
+            case IndicatorType::RSI: BatchIndicators::RSI(block, key.param1, values); break;
+            case IndicatorType::ATR: BatchIndicators::ATR(block, key.param1, values); break;
+            case IndicatorType::BOLLINGER:
+                BatchIndicators::BollingerBand(block, key.param1, key.param4, bands);
+                break;
+            default: break;
+        }
+
+        // 종목별 열을 xxxVector 정렬로 잘라 넣음 (첫 값 = 첫 유효 봉 + warmup)
+        for (size_t i = 0; i < count; ++i) {
+            size_t first = block.firstValidBar(i) + IndicatorColumns::warmup(key);
+            if (key.type == IndicatorType::BOLLINGER) {
+                std::vector<BollingerBands> column;
+                for (size_t t = first; t < numBars; ++t) {
+                    size_t idx = block.index(t, i);
+                    BollingerBands bb = {bands.upper[idx], bands.middle[idx], bands.lower[idx],
+                                         bands.bandwidth[idx], 0};
+                    if (bb.upper != bb.lower) {
+                        bb.percentB = (block.close[idx] - bb.lower) / (bb.upper - bb.lower);
+                    }
+                    column.push_back(bb);
+                }
+                contexts[i]->preloadBands(key, std::move(column));
+            } else {
+                std::vector<double> column;
+                for (size_t t = first; t < numBars; ++t) {
+                    column.push_back(values[block.index(t, i)]);
+                }
+                contexts[i]->preload(key, std::move(column));
+            }
+        }
+    }
+
+    for (auto& ctx : contexts) {
+        indicatorCache.publish(ctx);
+    }
+    return count;
+}
+
 void StrategyManager::setRiskManager(RiskManager* rm) {
     riskManager = rm;
 }
 
+std::vector<StrategyStatus> StrategyManager::getStatusSnapshot() const {
+    std::lock_guard<std::mutex> lock(statusMutex);
+    std::vector<StrategyStatus> snapshot = status;
+    for (size_t i = 0; i < snapshot.size(); ++i) {
+        snapshot[i].enabled = strategies[i]->isEnabled();
+    }
+    return snapshot;
+}
+
 } // namespace yuanta
@@ -1,5 +1,6 @@
 #include "../../include/Strategy.h"
 #include "../../include/TechnicalIndicators.h"
+#include "../../include/Clock.h"
 #include <ctime>
 #include <algorithm>
 #include <iostream>
@@ -8,9 +9,11 @@ namespace yuanta {
 
 GapPullbackStrategy::GapPullbackStrategy() {}
 
-SignalInfo GapPullbackStrategy::analyze(const std::string& code,
-                                         const std::vector<OHLCV>& candles,
+SignalInfo GapPullbackStrategy::analyze(const IndicatorContext& ctx,
                                          const QuoteData& quote) {
+    const std::string& code = ctx.getCode();
+    Span<OHLCV> candles = ctx.getCandles();
+
     SignalInfo signal;
     signal.code = code;
     signal.signal = Signal::NONE;
@@ -39,16 +42,24 @@ SignalInfo GapPullbackStrategy::analyze(const std::string& code,
     double currentPrice = quote.currentPrice;
 
     // 아침 고점 갱신
-    auto it = morningHighs.find(code);
-    if (it == morningHighs.end()) {
-        morningHighs[code] = currentPrice;
-    } else if (currentPrice > it->second) {
-        morningHighs[code] = currentPrice;
-        pullbackDetected[code] = false;  // 고점 갱신 시 눌림 리셋
+    SymbolId id = ctx.getSymbolId();
+    if (id == INVALID_SYMBOL_ID) {
+        return signal;
+    }
+    if (id >= morningHighs.size()) {
+        morningHighs.resize(id + 1, 0.0);
+        pullbackDetected.resize(id + 1, 0);
+    }
+
+    if (morningHighs[id] <= 0) {
+        morningHighs[id] = currentPrice;
+    } else if (currentPrice > morningHighs[id]) {
+        morningHighs[id] = currentPrice;
+        pullbackDetected[id] = 0;  // 고점 갱신 시 눌림 리셋
     }
 
     // 3. 눌림목 확인 (고점 대비 0.5% ~ 1.5% 하락)
-    if (!checkPullback(code, currentPrice)) {
+    if (!checkPullback(id, currentPrice)) {
         return signal;
     }
 
@@ -58,7 +69,7 @@ SignalInfo GapPullbackStrategy::analyze(const std::string& code,
     }
 
     // 5. VWAP 위에 있는지 확인
-    if (!checkVWAP(currentPrice, candles)) {
+    if (!checkVWAP(currentPrice, ctx)) {
         return signal;
     }
 
@@ -91,12 +102,7 @@ bool GapPullbackStrategy::shouldClose(const Position& position,
     }
 
     // 시간 기반 청산 (14:30 이후)
-    auto now = std::chrono::system_clock::now();
-    std::time_t t = std::chrono::system_clock::to_time_t(now);
-    std::tm* tm = std::localtime(&t);
-    int minutes = tm->tm_hour * 60 + tm->tm_min;
-
-    if (minutes >= 870) {  // 14:30
+    if (currentClock().session().minuteOfDay >= SessionTime::TIME_STOP) {
         return true;
     }
 
@@ -126,6 +132,16 @@ double GapPullbackStrategy::getParameter(const std::string& name) const {
     return 0.0;
 }
 
+std::vector<std::string> GapPullbackStrategy::parameterNames() const {
+    return {"minGapPercent", "maxGapPercent", "pullbackMin", "pullbackMax",
+            "volumeMultiple", "takeProfitPercent", "stopLossPercent", "entryWindowMinutes"};
+}
+
+size_t GapPullbackStrategy::minimumBars() const {
+    // 거래량 확인에 20봉
+    return 20;
+}
+
 bool GapPullbackStrategy::checkGapUp(const QuoteData& quote, double prevClose) const {
     if (prevClose <= 0) return false;
 
@@ -134,11 +150,10 @@ bool GapPullbackStrategy::checkGapUp(const QuoteData& quote, double prevClose) c
     return gapPercent >= minGapPercent && gapPercent <= maxGapPercent;
 }
 
-bool GapPullbackStrategy::checkPullback(const std::string& code, double currentPrice) const {
-    auto it = morningHighs.find(code);
-    if (it == morningHighs.end()) return false;
+bool GapPullbackStrategy::checkPullback(SymbolId id, double currentPrice) const {
+    if (id >= morningHighs.size()) return false;
 
-    double morningHigh = it->second;
+    double morningHigh = morningHighs[id];
     if (morningHigh <= 0) return false;
 
     double pullbackPercent = ((morningHigh - currentPrice) / morningHigh) * 100.0;
@@ -147,7 +162,7 @@ bool GapPullbackStrategy::checkPullback(const std::string& code, double currentP
     return pullbackPercent >= pullbackMin && pullbackPercent <= pullbackMax;
 }
 
-bool GapPullbackStrategy::checkVolume(const std::vector<OHLCV>& candles) const {
+bool GapPullbackStrategy::checkVolume(Span<OHLCV> candles) const {
     if (candles.size() < 20) return false;
 
     // 최근 5분 평균 거래량
@@ -170,20 +185,16 @@ bool GapPullbackStrategy::checkVolume(const std::vector<OHLCV>& candles) const {
     return static_cast<double>(recentVolume) >= static_cast<double>(prevVolume) * volumeMultiple;
 }
 
-bool GapPullbackStrategy::checkVWAP(double currentPrice, const std::vector<OHLCV>& candles) const {
-    if (candles.empty()) return false;
+bool GapPullbackStrategy::checkVWAP(double currentPrice, const IndicatorContext& ctx) const {
+    Span<double> vwap = ctx.vwap();
+    if (vwap.empty()) return false;
 
-    double vwap = TechnicalIndicators::VWAP(candles);
-    return currentPrice > vwap;
+    return currentPrice > vwap.back();
 }
 
 bool GapPullbackStrategy::isWithinEntryWindow() const {
-    auto now = std::chrono::system_clock::now();
-    std::time_t t = std::chrono::system_clock::to_time_t(now);
-    std::tm* tm = std::localtime(&t);
-
-    int minutes = tm->tm_hour * 60 + tm->tm_min;
-    int marketOpen = 540;  // 09:00
+    int minutes = currentClock().session().minuteOfDay;
+    int marketOpen = SessionTime::MARKET_OPEN;  // 09:00
 
     return minutes >= marketOpen && minutes <= (marketOpen + entryWindowMinutes);
 }
@@ -1,5 +1,6 @@
 #include "../../include/Strategy.h"
 #include "../../include/TechnicalIndicators.h"
+#include "../../include/Clock.h"
 #include <ctime>
 #include <algorithm>
 
@@ -7,11 +8,12 @@ namespace yuanta {
 
 MABreakoutStrategy::MABreakoutStrategy() {}
 
-SignalInfo MABreakoutStrategy::analyze(const std::string& code,
-                                        const std::vector<OHLCV>& candles,
+SignalInfo MABreakoutStrategy::analyze(const IndicatorContext& ctx,
                                         const QuoteData& quote) {
+    Span<OHLCV> candles = ctx.getCandles();
+
     SignalInfo signal;
-    signal.code = code;
+    signal.code = ctx.getCode();
     signal.signal = Signal::NONE;
 
     if (!enabled) return signal;
@@ -21,16 +23,10 @@ SignalInfo MABreakoutStrategy::analyze(const std::string& code,
         return signal;
     }
 
-    // 종가 배열 추출
-    std::vector<double> closes;
-    for (const auto& candle : candles) {
-        closes.push_back(candle.close);
-    }
-
-    // 이동평균선 계산
-    auto ma5 = TechnicalIndicators::SMAVector(closes, fastMA);
-    auto ma10 = TechnicalIndicators::SMAVector(closes, midMA);
-    auto ma20 = TechnicalIndicators::SMAVector(closes, slowMA);
+    // 이동평균선 (공유 캐시)
+    Span<double> ma5 = ctx.sma(fastMA);
+    Span<double> ma10 = ctx.sma(midMA);
+    Span<double> ma20 = ctx.sma(slowMA);
 
     if (ma5.empty() || ma10.empty() || ma20.empty()) {
         return signal;
@@ -62,13 +58,17 @@ SignalInfo MABreakoutStrategy::analyze(const std::string& code,
     }
 
     // 4. RSI 확인 (50~70)
-    double rsi = TechnicalIndicators::RSI(closes, 14);
+    Span<double> rsiVector = ctx.rsi(14);
+    if (rsiVector.empty()) {
+        return signal;
+    }
+    double rsi = rsiVector.back();
     if (!checkRSI(rsi)) {
         return signal;
     }
 
     // 5. MACD 양전환 확인
-    auto macd = TechnicalIndicators::MACD(closes);
+    const auto& macd = ctx.macd();
     if (!checkMACDCross(macd)) {
         return signal;
     }
@@ -111,12 +111,7 @@ bool MABreakoutStrategy::shouldClose(const Position& position,
     }
 
     // 시간 기반 청산 (14:30 이후)
-    auto now = std::chrono::system_clock::now();
-    std::time_t t = std::chrono::system_clock::to_time_t(now);
-    std::tm* tm = std::localtime(&t);
-    int minutes = tm->tm_hour * 60 + tm->tm_min;
-
-    if (minutes >= 870) {
+    if (currentClock().session().minuteOfDay >= SessionTime::TIME_STOP) {
         return true;
     }
 
@@ -148,9 +143,29 @@ double MABreakoutStrategy::getParameter(const std::string& name) const {
     return 0.0;
 }
 
-bool MABreakoutStrategy::checkMAAlignment(const std::vector<double>& ma5,
-                                           const std::vector<double>& ma10,
-                                           const std::vector<double>& ma20) const {
+std::vector<std::string> MABreakoutStrategy::parameterNames() const {
+    return {"fastMA", "midMA", "slowMA", "volumeMultiple", "rsiMin", "rsiMax",
+            "takeProfit1Percent", "takeProfit2Percent", "stopLossPercent"};
+}
+
+size_t MABreakoutStrategy::minimumBars() const {
+    // 가장 긴 이동평균 + 5봉, MACD(12, 26, 9)는 35봉
+    int longest = (std::max)(fastMA, (std::max)(midMA, slowMA));
+    return (std::max)(static_cast<size_t>((std::max)(longest, 0)) + 5, size_t(35));
+}
+
+std::vector<IndicatorKey> MABreakoutStrategy::requiredIndicators() const {
+    return {
+        IndicatorKey{IndicatorType::SMA, fastMA},
+        IndicatorKey{IndicatorType::SMA, midMA},
+        IndicatorKey{IndicatorType::SMA, slowMA},
+        IndicatorKey{IndicatorType::RSI, 14},
+        IndicatorKey{IndicatorType::MACD, 12, 26, 9}
+    };
+}
+
+bool MABreakoutStrategy::checkMAAlignment(Span<double> ma5, Span<double> ma10,
+                                           Span<double> ma20) const {
     if (ma5.empty() || ma10.empty() || ma20.empty()) return false;
 
     // 가장 최근 값으로 정배열 확인
@@ -161,7 +176,7 @@ bool MABreakoutStrategy::checkMAAlignment(const std::vector<double>& ma5,
     return latest5 > latest10 && latest10 > latest20;
 }
 
-bool MABreakoutStrategy::checkMABreakout(double price, const std::vector<double>& ma20) const {
+bool MABreakoutStrategy::checkMABreakout(double price, Span<double> ma20) const {
     if (ma20.size() < 2) return false;
 
     double current20MA = ma20.back();
@@ -8,6 +8,7 @@
 #endif
 
 #include "../../include/WebServer.h"
+#include "../../include/TimeUtil.h"
 #include <sstream>
 #include <iomanip>
 #include <chrono>
@@ -148,13 +149,13 @@ std::string WebServer::generateDashboardHtml() {
 
     auto now = std::chrono::system_clock::now();
     auto nowTime = std::chrono::system_clock::to_time_t(now);
-    struct tm* tm_info = localtime(&nowTime);
+    std::tm tm_info = toLocalTime(nowTime);
 
-    std::string timeStr = (tm_info->tm_hour < 12) ? "AM " : "PM ";
+    std::string timeStr = (tm_info.tm_hour < 12) ? "AM " : "PM ";
     char hourMin[10];
-    int hour12 = tm_info->tm_hour % 12;
+    int hour12 = tm_info.tm_hour % 12;
     if (hour12 == 0) hour12 = 12;
-    sprintf(hourMin, "%02d:%02d:%02d", hour12, tm_info->tm_min, tm_info->tm_sec);
+    sprintf(hourMin, "%02d:%02d:%02d", hour12, tm_info.tm_min, tm_info.tm_sec);
     timeStr += hourMin;
 
     std::ostringstream html;
@@ -295,9 +296,9 @@ std::string WebServer::generateDashboardHtml() {
         else if (log.type == "SELL") logClass = "log-sell";
 
         time_t t = log.timestamp / 1000;
-        struct tm* tm_log = localtime(&t);
+        std::tm tm_log = toLocalTime(t);
         char logTimeStr[20];
-        strftime(logTimeStr, 20, "%H:%M:%S", tm_log);
+        strftime(logTimeStr, 20, "%H:%M:%S", &tm_log);
 
         html << "        <div class=\"log-entry " << logClass << "\">";
         html << "<span>[" << log.type << "] " << log.code << " - " << log.message;
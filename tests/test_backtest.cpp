@@ -0,0 +1,833 @@
+#include "../include/Backtester.h"
+#include "../include/FillModel.h"
+#include "../include/MonteCarlo.h"
+#include "../include/StrategyOptimizer.h"
+#include "../include/ThreadPool.h"
+#include "../include/TickReplayer.h"
+#include <map>
+#include <set>
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <sstream>
+#include <vector>
+#include <cmath>
+
+using namespace yuanta;
+
+#define TEST(name) std::cout << "Testing " << name << "... ";
+#define PASS() std::cout << "PASSED" << std::endl;
+#define FAIL(msg) std::cout << "FAILED: " << msg << std::endl; failures++;
+
+int failures = 0;
+
+bool approxEqual(double a, double b, double epsilon = 1e-9) {
+    return std::abs(a - b) < epsilon;
+}
+
+OHLCV makeBar(double open, double high, double low, double close, long long volume,
+              long long timestamp = 0) {
+    OHLCV bar;
+    bar.open = open;
+    bar.high = high;
+    bar.low = low;
+    bar.close = close;
+    bar.volume = volume;
+    bar.timestamp = timestamp;
+    return bar;
+}
+
+void testKrxTickSize() {
+    TEST("KRX Tick Size");
+
+    // 구간 경계 바로 아래/위
+    struct Case { double price; double tick; };
+    const Case cases[] = {
+        {1, 1}, {1999, 1}, {2000, 5}, {4999, 5}, {5000, 10}, {19999, 10}, {20000, 50},
+        {49999, 50}, {50000, 100}, {199999, 100}, {200000, 500}, {499999, 500},
+        {500000, 1000}, {2000000, 1000},
+    };
+
+    bool ok = true;
+    for (const Case& c : cases) {
+        if (FillModel::tickSize(c.price) != c.tick) {
+            ok = false;
+            FAIL("tickSize(" << c.price << ") = " << FillModel::tickSize(c.price)
+                 << ", expected " << c.tick);
+            break;
+        }
+    }
+
+    if (ok) {
+        PASS();
+    }
+}
+
+void testTickRounding() {
+    TEST("Tick Rounding");
+
+    // 호가 단위 위의 가격은 그대로, 사이 가격은 위/아래 호가로
+    bool ok = FillModel::roundUpToTick(2005) == 2005 && FillModel::roundDownToTick(2005) == 2005 &&
+              FillModel::roundUpToTick(2003) == 2005 && FillModel::roundDownToTick(2003) == 2000 &&
+              FillModel::roundUpToTick(1999.5) == 2000 && FillModel::roundDownToTick(1999.5) == 1999 &&
+              FillModel::roundUpToTick(50049) == 50100 && FillModel::roundDownToTick(50049) == 50000 &&
+              FillModel::roundUpToTick(50000) == 50000 && FillModel::roundDownToTick(50000) == 50000 &&
+              FillModel::roundUpToTick(499999.5) == 500000 &&
+              FillModel::roundDownToTick(499999.5) == 499500 &&
+              FillModel::roundUpToTick(70000.0000001) == 70000;   // 부동소수점 오차는 흡수
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("Unexpected rounding result");
+    }
+}
+
+void testGapFills() {
+    TEST("Gap-Through Fills");
+
+    FillModelConfig config;
+    config.baseSlippage = 0.0;
+    config.impactCoefficient = 0.0;
+    IntrabarFillModel model(config);
+
+    // 시가가 손절가 아래: 손절가가 아니라 시가에 체결
+    ExitFill down = model.checkExit(makeBar(9700, 9750, 9600, 9700, 100000), 9800, 10300, 10);
+    // 시가가 익절가 위: 지정가가 아니라 (더 좋은) 시가에 체결
+    ExitFill up = model.checkExit(makeBar(10500, 10600, 10450, 10550, 100000), 9800, 10300, 10);
+    // 갭 없이 봉 안에서 닿으면 트리거 가격에 체결
+    ExitFill inside = model.checkExit(makeBar(10000, 10100, 9750, 9900, 100000), 9800, 10300, 10);
+    ExitFill none = model.checkExit(makeBar(10000, 10100, 9900, 10050, 100000), 9800, 10300, 10);
+
+    bool ok = down.kind == ExitFill::Kind::STOP_LOSS && down.price == 9700 &&
+              up.kind == ExitFill::Kind::TAKE_PROFIT && up.price == 10500 &&
+              inside.kind == ExitFill::Kind::STOP_LOSS && inside.price == 9800 &&
+              !none.triggered();
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("gap down " << down.price << ", gap up " << up.price << ", inside " << inside.price);
+    }
+}
+
+void testVolumeSlippage() {
+    TEST("Volume Participation Slippage");
+
+    FillModelConfig config;
+    config.baseSlippage = 0.0005;
+    config.impactCoefficient = 0.01;
+    config.maxSlippage = 0.02;
+    config.roundToTick = false;
+    IntrabarFillModel model(config);
+
+    // 참여율 1% → 0.0005 + 0.01 × 0.1, 참여율 4배 → 충격 2배 (제곱근)
+    double onePercent = model.slippage(100, 10000);
+    double fourPercent = model.slippage(400, 10000);
+    double capped = model.slippage(1000000, 10000);
+    double noVolume = model.slippage(10, 0);
+
+    bool ok = approxEqual(onePercent, 0.0015) &&
+              approxEqual(fourPercent - 0.0005, 2.0 * (onePercent - 0.0005)) &&
+              approxEqual(capped, 0.02) &&
+              approxEqual(noVolume, 0.0105) &&
+              approxEqual(model.buyPrice(10000, 100, 10000), 10015) &&
+              approxEqual(model.sellPrice(10000, 100, 10000), 9985);
+
+    // 호가 단위 반올림: 매수는 올림, 매도는 내림
+    config.roundToTick = true;
+    IntrabarFillModel rounded(config);
+    ok = ok && rounded.buyPrice(10000, 100, 10000) == 10020 &&
+         rounded.sellPrice(10000, 100, 10000) == 9980;
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("slippage 1% " << onePercent << ", 4% " << fourPercent << ", capped " << capped);
+    }
+}
+
+void testIntrabarPath() {
+    TEST("Intrabar Path Assumptions");
+
+    FillModelConfig config;
+    config.baseSlippage = 0.0;
+    config.impactCoefficient = 0.0;
+
+    // 한 봉이 손절가(9800)와 익절가(10300)를 모두 지남
+    OHLCV bullish = makeBar(10000, 10400, 9700, 10200, 100000);
+    OHLCV bearish = makeBar(10000, 10400, 9700, 9900, 100000);
+
+    auto kindFor = [&](IntrabarPath path, const OHLCV& bar) {
+        config.path = path;
+        return IntrabarFillModel(config).checkExit(bar, 9800, 10300, 10).kind;
+    };
+
+    using Kind = ExitFill::Kind;
+    bool ok = kindFor(IntrabarPath::PESSIMISTIC, bullish) == Kind::STOP_LOSS &&
+              kindFor(IntrabarPath::PESSIMISTIC, bearish) == Kind::STOP_LOSS &&
+              kindFor(IntrabarPath::OPTIMISTIC, bullish) == Kind::TAKE_PROFIT &&
+              kindFor(IntrabarPath::OPTIMISTIC, bearish) == Kind::TAKE_PROFIT &&
+              // 양봉: 시가→저가→고가 (손절 먼저), 음봉: 시가→고가→저가 (익절 먼저)
+              kindFor(IntrabarPath::BAR_DIRECTION, bullish) == Kind::STOP_LOSS &&
+              kindFor(IntrabarPath::BAR_DIRECTION, bearish) == Kind::TAKE_PROFIT;
+
+    // 익절 지정가는 호가 단위로 올림: 10301 → 10310, 고가 10305면 미체결
+    config.path = IntrabarPath::PESSIMISTIC;
+    IntrabarFillModel model(config);
+    ExitFill below = model.checkExit(makeBar(10200, 10305, 10150, 10250, 1000), 9800, 10301, 10);
+    ExitFill at = model.checkExit(makeBar(10200, 10310, 10150, 10250, 1000), 9800, 10301, 10);
+    ok = ok && !below.triggered() && at.kind == Kind::TAKE_PROFIT && at.price == 10310;
+
+    // 이전 방식은 종가로만 판단
+    CloseFillModel closeModel(0.001);
+    ok = ok && !closeModel.checkExit(bullish, 9800, 10300, 10).triggered() &&
+         closeModel.checkExit(makeBar(10000, 10000, 9700, 9750, 1000), 9800, 10300, 10).kind ==
+             Kind::STOP_LOSS;
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("Stop/target ordering does not follow the path assumption");
+    }
+}
+
+std::vector<BacktestTrade> makeTrades(const std::vector<double>& pnl) {
+    std::vector<BacktestTrade> trades;
+    for (size_t i = 0; i < pnl.size(); ++i) {
+        BacktestTrade trade{};
+        trade.code = "005930";
+        trade.entryTime = static_cast<long long>(i) * 60000;
+        trade.exitTime = trade.entryTime + 60000;
+        trade.pnl = pnl[i];
+        trades.push_back(trade);
+    }
+    return trades;
+}
+
+void testMonteCarloDeterminism() {
+    TEST("Monte Carlo Determinism");
+
+    std::vector<BacktestTrade> trades =
+        makeTrades({120000, -80000, 45000, -150000, 60000, 30000, -20000, 90000, -60000, 10000});
+
+    // 스레드 수가 다르면 구간 분할도 달라짐 (1스레드: 625개씩, 4스레드: 256개씩)
+    ThreadPool single(1);
+    ThreadPool quad(4);
+
+    bool ok = true;
+    for (auto method : {MonteCarloConfig::Method::BOOTSTRAP,
+                        MonteCarloConfig::Method::BLOCK_BOOTSTRAP,
+                        MonteCarloConfig::Method::SHUFFLE}) {
+        MonteCarloConfig config;
+        config.method = method;
+        config.resamples = 5000;
+        config.blockSize = 3;
+        config.seed = 7;
+
+        MonteCarloResult a = MonteCarloSimulator(single).run(trades, config);
+        MonteCarloResult b = MonteCarloSimulator(quad).run(trades, config);
+        MonteCarloResult c = MonteCarloSimulator(quad).run(trades, config);
+
+        config.seed = 8;
+        MonteCarloResult other = MonteCarloSimulator(quad).run(trades, config);
+
+        ok = ok && a.resamples == 5000 && a.returns == b.returns && a.drawdowns == b.drawdowns &&
+             b.returns == c.returns && b.drawdowns == c.drawdowns &&
+             a.riskOfRuin == b.riskOfRuin && a.drawdowns != other.drawdowns;
+    }
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("Resample paths depend on thread count or seed is ignored");
+    }
+}
+
+void testMonteCarloShuffle() {
+    TEST("Monte Carlo Shuffle");
+
+    std::vector<double> pnl = {200000, -100000, 50000, -250000, 80000, 40000, -30000};
+    double total = 0.0;
+    for (double v : pnl) total += v;
+    double expectedReturn = total / Backtester::INITIAL_CASH * 100.0;
+
+    ThreadPool pool(2);
+    MonteCarloConfig config;
+    config.method = MonteCarloConfig::Method::SHUFFLE;
+    config.resamples = 2000;
+    MonteCarloResult result = MonteCarloSimulator(pool).run(makeTrades(pnl), config);
+
+    // 순서만 바뀌므로 총수익은 모든 경로에서 같고, 낙폭만 경로마다 다름
+    bool ok = result.returns.size() == 2000;
+    for (double r : result.returns) {
+        ok = ok && approxEqual(r, expectedReturn, 1e-9);
+    }
+    ok = ok && result.totalReturn.stdDev < 1e-9 &&
+         result.maxDrawdown.stdDev > 0.0 && result.maxDrawdown.min < result.maxDrawdown.max;
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("Shuffle changed total return or left drawdown fixed (std "
+             << result.maxDrawdown.stdDev << ")");
+    }
+}
+
+void testMonteCarloStatistics() {
+    TEST("Monte Carlo Statistics");
+
+    // 백분위 선형 보간: {1,2,3,4,5}, 80% 구간 → 하한 0.1 × 4 = 1.4번째, 상한 3.6번째
+    MonteCarloDistribution dist = MonteCarloSimulator::summarize({4, 1, 3, 2, 5}, 0.8);
+    bool ok = approxEqual(dist.mean, 3.0) && approxEqual(dist.stdDev, std::sqrt(2.0)) &&
+              approxEqual(dist.lower, 1.4) && approxEqual(dist.median, 3.0) &&
+              approxEqual(dist.upper, 4.6) && dist.min == 1.0 && dist.max == 5.0;
+
+    // 거래 두 건 (+10%, -5%)의 부트스트랩: 경로는 ++, +-, -+, -- 가 각각 1/4
+    //   총수익률: +20% / +5% / +5% / -10%
+    //   최대 낙폭: 0 / 50000/1100000 = 4.55% / 5% / 100000/1000000 = 10%
+    ThreadPool pool(2);
+    MonteCarloConfig config;
+    config.resamples = 100000;
+    config.initialCapital = 1000000.0;
+    config.ruinDrawdown = 10.0;
+    config.confidence = 0.95;
+    MonteCarloResult result = MonteCarloSimulator(pool).run(makeTrades({100000, -50000}), config);
+
+    ok = ok && approxEqual(result.totalReturn.mean, 5.0, 0.2) &&
+         approxEqual(result.totalReturn.median, 5.0) &&
+         approxEqual(result.totalReturn.lower, -10.0) && approxEqual(result.totalReturn.upper, 20.0) &&
+         approxEqual(result.totalReturn.min, -10.0) && approxEqual(result.totalReturn.max, 20.0) &&
+         approxEqual(result.maxDrawdown.max, 10.0) && approxEqual(result.maxDrawdown.min, 0.0) &&
+         approxEqual(result.riskOfRuin, 25.0, 1.0) &&
+         approxEqual(result.probabilityOfLoss, 25.0, 1.0);
+
+    for (double dd : result.drawdowns) {
+        ok = ok && (approxEqual(dd, 0.0) || approxEqual(dd, 50000.0 / 1100000.0 * 100.0) ||
+                    approxEqual(dd, 5.0) || approxEqual(dd, 10.0));
+    }
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("mean " << result.totalReturn.mean << ", ruin " << result.riskOfRuin
+             << "%, loss " << result.probabilityOfLoss << "%");
+    }
+}
+
+// 종목마다 한 번, 지정한 손절/익절가로 매수 신호를 내는 리플레이 검증용 전략
+class ProbeStrategy : public Strategy {
+public:
+    explicit ProbeStrategy(std::map<std::string, std::pair<double, double>> levels)
+        : levels(std::move(levels)) {}
+
+    std::string getName() const override { return "Probe"; }
+
+    using Strategy::analyze;
+    SignalInfo analyze(const IndicatorContext& ctx, const QuoteData& quote) override {
+        SignalInfo signal;
+        auto it = levels.find(ctx.getCode());
+        if (it == levels.end() || !bought.insert(ctx.getCode()).second) return signal;
+
+        signal.signal = Signal::BUY;
+        signal.code = ctx.getCode();
+        signal.price = quote.currentPrice;
+        signal.stopLoss = it->second.first;
+        signal.takeProfit1 = it->second.second;
+        return signal;
+    }
+
+    bool shouldClose(const Position&, const QuoteData&) override { return false; }
+
+private:
+    std::map<std::string, std::pair<double, double>> levels;
+    std::set<std::string> bought;
+};
+
+const long long REPLAY_BASE_TIME = 1704067200000LL;     // 2024-01-01 09:00 KST
+
+void testReplayCandleRebuild() {
+    TEST("Tick Replay Candle Rebuild");
+
+    // 양봉/음봉이 섞인 분봉 (틱 경로: 시가 → 저가/고가 → 고가/저가 → 종가)
+    std::vector<OHLCV> bars = {
+        makeBar(100, 105, 98, 104, 400, REPLAY_BASE_TIME),
+        makeBar(104, 106, 101, 102, 803, REPLAY_BASE_TIME + 60000),
+        makeBar(102, 103, 99, 100, 1200, REPLAY_BASE_TIME + 120000),
+        makeBar(100, 108, 100, 107, 57, REPLAY_BASE_TIME + 180000),
+        makeBar(107, 107, 107, 107, 4, REPLAY_BASE_TIME + 240000),
+    };
+    BarHistory history;
+    history["910001"] = bars;
+
+    std::vector<OHLCV> rebuilt;
+    ReplayConfig config;
+    config.ticksPerBar = 4;
+    config.strategyFactory = [](const std::string&) {
+        return std::unique_ptr<Strategy>(new ProbeStrategy({}));
+    };
+    config.strategies = {"Probe"};
+    config.onMinuteCandle = [&rebuilt](const std::string&, const OHLCV& candle) {
+        rebuilt.push_back(candle);
+    };
+
+    TickReplayer replayer(config);
+    ReplayResult result = replayer.replayBars(history);
+
+    // 마지막 봉은 다음 틱이 없어 완성되지 않음 (실거래 분봉 집계와 동일)
+    bool ok = result.ticks == 20 && rebuilt.size() == bars.size() - 1;
+    for (size_t i = 0; ok && i < rebuilt.size(); ++i) {
+        const OHLCV& a = rebuilt[i];
+        const OHLCV& b = bars[i];
+        ok = a.timestamp == b.timestamp && a.open == b.open && a.high == b.high &&
+             a.low == b.low && a.close == b.close && a.volume == b.volume;
+        if (!ok) {
+            FAIL("Bar " << i << " rebuilt as O" << a.open << " H" << a.high << " L" << a.low
+                 << " C" << a.close << " V" << a.volume);
+            return;
+        }
+    }
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("Rebuilt " << rebuilt.size() << " candles from " << result.ticks << " ticks");
+    }
+}
+
+void testReplayIntrabarExits() {
+    TEST("Tick Replay Intrabar Exits");
+
+    // 두 종목 모두 첫 봉 완성 후 (두 번째 봉 첫 틱) 매수
+    //   910011: 음봉 100 → 101 → 95 → 97, 손절 96 → 세 번째 틱(95)에서 손절
+    //   910012: 양봉 100 → 99 → 110 → 109, 익절 110 → 세 번째 틱(110)에서 익절
+    BarHistory history;
+    history["910011"] = {
+        makeBar(100, 100, 100, 100, 100, REPLAY_BASE_TIME),
+        makeBar(100, 101, 95, 97, 100, REPLAY_BASE_TIME + 60000),
+        makeBar(97, 97, 97, 97, 100, REPLAY_BASE_TIME + 120000),
+    };
+    history["910012"] = {
+        makeBar(100, 100, 100, 100, 100, REPLAY_BASE_TIME),
+        makeBar(100, 110, 99, 109, 100, REPLAY_BASE_TIME + 60000),
+        makeBar(109, 109, 109, 109, 100, REPLAY_BASE_TIME + 120000),
+    };
+
+    ReplayConfig config;
+    config.ticksPerBar = 4;
+    config.strategies = {"Probe"};
+    config.strategyFactory = [](const std::string&) {
+        return std::unique_ptr<Strategy>(new ProbeStrategy({
+            {"910011", {96.0, 120.0}},
+            {"910012", {90.0, 110.0}},
+        }));
+    };
+    FillModelConfig fills;
+    fills.baseSlippage = 0.0;
+    fills.impactCoefficient = 0.0;
+    fills.roundToTick = false;
+    config.fillModel = std::make_shared<IntrabarFillModel>(fills);
+
+    TickReplayer replayer(config);
+    ReplayResult result = replayer.replayBars(history);
+
+    const BacktestTrade* stop = nullptr;
+    const BacktestTrade* target = nullptr;
+    for (const auto& trade : result.trades) {
+        if (trade.code == "910011") stop = &trade;
+        if (trade.code == "910012") target = &trade;
+    }
+
+    long long entryTime = REPLAY_BASE_TIME + 60000;
+    long long thirdTick = entryTime + 30000;
+    bool ok = result.trades.size() == 2 && stop && target &&
+              stop->exitReason == "StopLoss" && stop->entryPrice == 100 &&
+              stop->entryTime == entryTime && stop->exitTime == thirdTick && stop->exitPrice == 95 &&
+              target->exitReason == "TakeProfit" && target->entryPrice == 100 &&
+              target->exitTime == thirdTick && target->exitPrice == 110;
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL(result.trades.size() << " trades; stop exit "
+             << (stop ? stop->exitPrice : 0) << " @" << (stop ? stop->exitTime - entryTime : 0)
+             << ", target exit " << (target ? target->exitPrice : 0));
+    }
+}
+
+// ============================================================================
+// StrategyOptimizer
+// ============================================================================
+
+ParameterRange makeRange(const std::string& name, double minValue, double maxValue, double step) {
+    ParameterRange range;
+    range.name = name;
+    range.minValue = minValue;
+    range.maxValue = maxValue;
+    range.step = step;
+    return range;
+}
+
+OptimizationResult makeOptimization(double value, int trades, double sharpe) {
+    OptimizationResult r;
+    r.parameters["id"] = value;
+    r.result.totalTrades = trades;
+    r.result.sharpeRatio = sharpe;
+    return r;
+}
+
+void testGridCombinations() {
+    TEST("Grid Combinations");
+
+    // 3 × 2 조합, 마지막 파라미터가 가장 빨리 바뀜. 0.1 간격도 끝값 포함
+    std::vector<ParameterRange> ranges = {
+        makeRange("a", 1.0, 3.0, 1.0),
+        makeRange("b", 0.1, 0.2, 0.1)
+    };
+    auto combos = StrategyOptimizer::gridCombinations(ranges, 100);
+
+    bool ok = combos.size() == 6;
+    if (ok) {
+        double expectA[] = {1, 1, 2, 2, 3, 3};
+        double expectB[] = {0.1, 0.2, 0.1, 0.2, 0.1, 0.2};
+        for (size_t i = 0; i < combos.size(); ++i) {
+            ok = ok && approxEqual(combos[i]["a"], expectA[i]) &&
+                 approxEqual(combos[i]["b"], expectB[i]);
+        }
+    }
+
+    // step <= 0이면 최솟값 하나, 상한을 넘으면 빈 결과
+    auto single = StrategyOptimizer::gridCombinations({makeRange("c", 5.0, 9.0, 0.0)}, 100);
+    auto capped = StrategyOptimizer::gridCombinations(ranges, 5);
+
+    if (ok && single.size() == 1 && approxEqual(single[0]["c"], 5.0) && capped.empty()) {
+        PASS();
+    } else {
+        FAIL("grid " << combos.size() << ", single " << single.size()
+             << ", capped " << capped.size());
+    }
+}
+
+void testRandomCombinations() {
+    TEST("Random Combinations");
+
+    std::vector<ParameterRange> ranges = {
+        makeRange("a", 10.0, 50.0, 5.0),     // 9개
+        makeRange("b", 1.0, 2.0, 0.25)       // 5개
+    };
+    auto first = StrategyOptimizer::randomCombinations(ranges, 20, 7);
+    auto again = StrategyOptimizer::randomCombinations(ranges, 20, 7);
+    auto other = StrategyOptimizer::randomCombinations(ranges, 20, 8);
+
+    // 같은 시드면 같은 조합, 중복 없음, 모두 격자점 위
+    bool onGrid = true;
+    std::set<ParameterSet> unique(first.begin(), first.end());
+    for (const auto& params : first) {
+        double a = params.at("a");
+        double b = params.at("b");
+        onGrid = onGrid && a >= 10.0 && a <= 50.0 && approxEqual(std::fmod(a - 10.0, 5.0), 0.0) &&
+                 b >= 1.0 && b <= 2.0 && approxEqual(std::fmod(b - 1.0, 0.25), 0.0);
+    }
+
+    // 조합 공간(45개)보다 많이 요청하면 있는 만큼만
+    auto exhausted = StrategyOptimizer::randomCombinations(ranges, 100, 7);
+    std::set<ParameterSet> exhaustedUnique(exhausted.begin(), exhausted.end());
+
+    if (first.size() == 20 && first == again && first != other && unique.size() == 20 &&
+        onGrid && exhausted.size() <= 45 && exhaustedUnique.size() == exhausted.size()) {
+        PASS();
+    } else {
+        FAIL("size " << first.size() << ", unique " << unique.size() << ", exhausted "
+             << exhausted.size());
+    }
+}
+
+void testOptimizerRank() {
+    TEST("Optimizer Rank");
+
+    OptimizerConfig config;
+    config.rankBy = OptimizerConfig::RankBy::SHARPE;
+    config.minTrades = 10;
+
+    // 거래 수 미달은 점수가 높아도 뒤로, 동점(2, 3)은 입력 순서 유지
+    std::vector<OptimizationResult> results = {
+        makeOptimization(0, 5, 3.0),
+        makeOptimization(1, 20, 0.5),
+        makeOptimization(2, 15, 1.5),
+        makeOptimization(3, 30, 1.5),
+        makeOptimization(4, 2, -1.0)
+    };
+    StrategyOptimizer::rank(results, config);
+
+    double expect[] = {2, 3, 1, 0, 4};
+    bool ok = results.size() == 5;
+    for (size_t i = 0; ok && i < results.size(); ++i) {
+        ok = approxEqual(results[i].parameters["id"], expect[i]);
+    }
+    ok = ok && approxEqual(results[0].score, 1.5) && approxEqual(results[3].score, 3.0);
+
+    // DRAWDOWN은 낙폭이 작을수록 높은 점수
+    config.rankBy = OptimizerConfig::RankBy::DRAWDOWN;
+    std::vector<OptimizationResult> byDrawdown = {
+        makeOptimization(0, 20, 0.0), makeOptimization(1, 20, 0.0)
+    };
+    byDrawdown[0].result.maxDrawdown = 8.0;
+    byDrawdown[1].result.maxDrawdown = 3.0;
+    StrategyOptimizer::rank(byDrawdown, config);
+    ok = ok && approxEqual(byDrawdown[0].parameters["id"], 1) &&
+         approxEqual(byDrawdown[0].score, -3.0);
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("unexpected rank order");
+    }
+}
+
+void testOptimizerParameterValidation() {
+    TEST("Optimizer Parameter Validation");
+
+    // 오타난 이름은 범위 검증과 백테스트 작업 모두에서 거부
+    bool known = StrategyOptimizer::validateRanges("MABreakout",
+        {makeRange("slowMA", 20, 40, 10), makeRange("rsiMin", 45, 55, 5)});
+    bool typo = StrategyOptimizer::validateRanges("MABreakout", {makeRange("slowMa", 20, 40, 10)});
+    bool otherStrategy = StrategyOptimizer::validateRanges("BBSqueeze", {makeRange("slowMA", 20, 40, 10)});
+
+    Backtester bt;
+    std::ostringstream quiet;
+    bt.setLog(&quiet);
+    bt.generateSimulatedData("000001", 2);
+    BacktestJob job;
+    job.strategyName = "MABreakout";
+    job.parameters["slowMa"] = 30.0;
+    bt.run(job);
+    bool rejected = quiet.str().empty() && bt.getTrades().empty() && bt.getEquityCurve().empty();
+
+    if (known && !typo && !otherStrategy && rejected) {
+        PASS();
+    } else {
+        FAIL("known " << known << ", typo " << typo << ", other " << otherStrategy
+             << ", job rejected " << rejected);
+    }
+}
+
+void testStrategyMinimumBars() {
+    TEST("Strategy Minimum Bars");
+
+    // 긴 기간을 주면 백테스트 lookback(기본 100봉)보다 커져야 신호가 나올 수 있음
+    auto ma = Backtester::createStrategy("MABreakout");
+    size_t maDefault = ma->minimumBars();
+    ma->setParameter("slowMA", 150);
+    size_t maLong = ma->minimumBars();
+
+    auto bb = Backtester::createStrategy("BBSqueeze");
+    size_t bbDefault = bb->minimumBars();
+    bb->setParameter("bbPeriod", 30);
+    bb->setParameter("squeezeLookback", 120);
+    size_t bbLong = bb->minimumBars();
+
+    if (maDefault == 35 && maLong == 155 && bbDefault == 69 && bbLong == 149) {
+        PASS();
+    } else {
+        FAIL("MA " << maDefault << "/" << maLong << ", BB " << bbDefault << "/" << bbLong);
+    }
+}
+
+void testDaySlicing() {
+    TEST("Backtest Day Slicing");
+
+    // 둘째 날은 200봉만 있는 단축 거래일: 구간은 봉 수가 아니라 봉 시각의 일자로 잘라야 함
+    const std::string csvPath = "test_days.csv";
+    const long long base = 1704067200000LL;    // 2024-01-01 09:00 (KST)
+    const int dayBars[] = {390, 200, 390, 390};
+    std::vector<long long> dayLast;
+    {
+        std::ofstream csv(csvPath);
+        csv << "timestamp,open,high,low,close,volume\n";
+        for (int d = 0; d < 4; d++) {
+            for (int m = 0; m < dayBars[d]; m++) {
+                long long t = base + d * DayIndex::DAY_MS + m * 60000LL;
+                csv << t << ",100,100.5,99.5,100,1000\n";
+            }
+            dayLast.push_back(base + d * DayIndex::DAY_MS + (dayBars[d] - 1) * 60000LL);
+        }
+    }
+
+    Backtester bt;
+    std::ostringstream quiet;
+    bt.setLog(&quiet);
+    bool loaded = bt.loadData(csvPath, "000001");
+    std::remove(csvPath.c_str());
+
+    // 셋째 날 하루만 매매 (둘째 날은 워밍업): 자산 곡선은 셋째 날 마감 한 점
+    BacktestJob job;
+    job.strategyName = "MABreakout";
+    job.firstDay = 2;
+    job.dayCount = 1;
+    job.warmupDays = 1;
+    bt.run(job);
+    const auto& curve = bt.getEquityCurve();
+
+    if (loaded && bt.tradingDays() == 4 && curve.size() == 1 && curve[0].first == dayLast[2]) {
+        PASS();
+    } else {
+        FAIL("days " << bt.tradingDays() << ", curve points " << curve.size());
+    }
+}
+
+void testWalkForward() {
+    TEST("Walk-Forward");
+
+    Backtester data;
+    data.generateSimulatedData("000001", 6);
+    ThreadPool pool(2);
+    StrategyOptimizer optimizer(data, pool);
+
+    WalkForwardConfig config;
+    config.optimizer.strategyName = "MABreakout";
+    // 거래량/RSI 조건을 풀어 짧은 이력에서도 거래가 나오게 함 (시뮬레이션 데이터는 초반에만 거래 가능한 가격대)
+    config.optimizer.ranges = {
+        makeRange("slowMA", 20, 30, 10),
+        makeRange("volumeMultiple", 0, 0, 0.0),
+        makeRange("rsiMin", 0, 0, 0.0),
+        makeRange("rsiMax", 100, 100, 0.0)
+    };
+    config.optimizer.minTrades = 0;
+    config.inSampleDays = 2;
+    config.outOfSampleDays = 1;
+    config.warmupDays = 1;
+    WalkForwardResult wf = optimizer.walkForward(config);
+
+    // 6일에서 학습 2일 + 검증 1일, 1일씩 이동: 시작일 0, 1, 2, 3
+    bool ok = wf.windows.size() == 4 && !wf.trades.empty();
+    double compounded = 1.0;
+    for (size_t w = 0; ok && w < wf.windows.size(); ++w) {
+        ok = wf.windows[w].inSampleStart == w && wf.windows[w].outOfSampleStart == w + 2;
+        compounded *= 1.0 + wf.windows[w].outOfSample.totalReturn / 100.0;
+    }
+
+    // 검증 거래는 모두 어느 구간의 검증 일자 안에서 진입
+    const long long base = 1704067200000LL;
+    for (const auto& trade : wf.trades) {
+        size_t day = static_cast<size_t>((trade.entryTime - base) / DayIndex::DAY_MS);
+        bool inWindow = false;
+        for (const auto& window : wf.windows) {
+            inWindow = inWindow || (day >= window.outOfSampleStart &&
+                                    day < window.outOfSampleStart + window.outOfSampleDays);
+        }
+        ok = ok && inWindow;
+    }
+
+    // 검증 일자마다 자산 한 점, 통합 수익률은 구간 수익률의 복리 연결
+    ok = ok && wf.equityCurve.size() == 4 &&
+         approxEqual(wf.aggregate.totalReturn, (compounded - 1.0) * 100.0, 1e-6);
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("windows " << wf.windows.size() << ", curve points " << wf.equityCurve.size()
+             << ", return " << wf.aggregate.totalReturn << " vs " << (compounded - 1.0) * 100.0);
+    }
+}
+
+void testDailyLossLimit() {
+    TEST("Backtest Daily Loss Limit");
+
+    // 40분 주기 톱니: 30분간 완만히 올라 매수 신호가 난 뒤 10분간 급락해 손절
+    const std::string csvPath = "test_sawtooth.csv";
+    {
+        std::ofstream csv(csvPath);
+        csv << "timestamp,open,high,low,close,volume\n";
+        double price = 50000.0;
+        for (int d = 0; d < 3; d++) {
+            for (int m = 0; m < 390; m++) {
+                double open = price;
+                price *= (m % 40 < 30) ? 1.001 : 0.992;
+                csv << (1704067200000LL + d * DayIndex::DAY_MS + m * 60000LL) << ","
+                    << open << "," << (std::max)(open, price) * 1.0005 << ","
+                    << (std::min)(open, price) * 0.9995 << "," << price << ",1000\n";
+            }
+        }
+    }
+    Backtester data;
+    bool loaded = data.loadData(csvPath, "000001");
+    std::remove(csvPath.c_str());
+
+    const std::map<std::string, double> loose = {
+        {"volumeMultiple", 0.0}, {"rsiMin", 0.0}, {"rsiMax", 100.0}, {"takeProfit1Percent", 20.0}
+    };
+
+    auto runWith = [&](double lossRatio, std::vector<BacktestTrade>& trades) {
+        Backtester bt;
+        std::ostringstream quiet;
+        bt.setLog(&quiet);
+        bt.shareHistory(data);
+        DailyBudgetConfig risk = bt.getRiskConfig();
+        risk.maxDailyLossRatio = lossRatio;
+        bt.setRiskConfig(risk);
+        bt.run("MABreakout", {}, loose);
+        trades = bt.getTrades();
+        return risk.getMaxDailyLoss();
+    };
+
+    std::vector<BacktestTrade> unlimited;
+    std::vector<BacktestTrade> capped;
+    runWith(1.0, unlimited);
+    double maxLoss = runWith(0.0005, capped);     // 하루 5,000원
+
+    // 같은 날 앞서 청산된 거래의 손실이 한도에 닿은 뒤에는 진입하지 않음
+    // (리스크 매니저 손익은 매수 수수료까지 빼므로 거래 기록 손익보다 작거나 같음)
+    bool blocked = true;
+    for (const auto& trade : capped) {
+        long long day = DayIndex::dayStart(trade.entryTime);
+        double realized = 0.0;
+        for (const auto& before : capped) {
+            if (DayIndex::dayStart(before.exitTime) == day && before.exitTime < trade.entryTime) {
+                realized += before.pnl;
+            }
+        }
+        blocked = blocked && realized > -maxLoss;
+    }
+
+    if (loaded && !unlimited.empty() && capped.size() < unlimited.size() && blocked) {
+        PASS();
+    } else {
+        FAIL("unlimited " << unlimited.size() << " trades, capped " << capped.size()
+             << ", entries after limit " << !blocked);
+    }
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "  Backtest Test Suite" << std::endl;
+    std::cout << "========================================\n" << std::endl;
+
+    testKrxTickSize();
+    testTickRounding();
+    testGapFills();
+    testVolumeSlippage();
+    testIntrabarPath();
+    testMonteCarloDeterminism();
+    testMonteCarloShuffle();
+    testMonteCarloStatistics();
+    testReplayCandleRebuild();
+    testReplayIntrabarExits();
+    testGridCombinations();
+    testRandomCombinations();
+    testOptimizerRank();
+    testOptimizerParameterValidation();
+    testStrategyMinimumBars();
+    testDaySlicing();
+    testWalkForward();
+    testDailyLossLimit();
+
+    std::cout << "\n========================================" << std::endl;
+    if (failures == 0) {
+        std::cout << "  All tests PASSED!" << std::endl;
+    } else {
+        std::cout << "  " << failures << " test(s) FAILED!" << std::endl;
+    }
+    std::cout << "========================================" << std::endl;
+
+    return failures;
+}
@@ -1,4 +1,24 @@
 #include "../include/TechnicalIndicators.h"
+#include "../include/BatchIndicators.h"
+#include "../include/RingBuffer.h"
+#include "../include/MarketDataManager.h"
+#include "../include/SPSCQueue.h"
+#include "../include/SeqLock.h"
+#include "../include/CSVBarParser.h"
+#include "../include/BarIndex.h"
+#include "../include/ThreadPool.h"
+#include "../include/IndicatorCache.h"
+#include "../include/BarStream.h"
+#include "../include/Clock.h"
+#include "../include/Strategy.h"
+#include "../include/StrategyEvaluator.h"
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <cstdio>
+#include <thread>
+#include <mutex>
+#include <stdexcept>
 #include <iostream>
 #include <cassert>
 #include <cmath>
@@ -156,6 +176,1013 @@ void testMAAlignment() {
     }
 }
 
+void testStreamingIndicators() {
+    TEST("Streaming Indicators");
+
+    StreamingIndicators si;
+    si.registerSMA(20);
+    si.registerRSI(14);
+    si.registerATR(14);
+    si.registerBB(20);
+    si.registerMACD();
+
+    std::vector<OHLCV> candles;
+    std::vector<double> closes;
+    for (int i = 0; i < 120; i++) {
+        OHLCV c;
+        c.open = 50000 + std::sin(i * 0.3) * 500;
+        c.close = c.open + std::cos(i * 0.7) * 200;
+        c.high = (std::max)(c.open, c.close) + 100;
+        c.low = (std::min)(c.open, c.close) - 100;
+        c.volume = 1000 + (i % 7) * 300;
+        c.timestamp = i * 60000LL;
+        candles.push_back(c);
+        closes.push_back(c.close);
+        si.addOHLCV(c);
+
+        // 이력이 쌓인 뒤 등록해도 지난 이력으로 초기화
+        if (i == 59) si.registerEMA(10);
+    }
+
+    auto bb = TechnicalIndicators::BollingerBand(closes, 20, 2.0);
+    auto sbb = si.getCurrentBB(20, 2.0);
+    auto macd = TechnicalIndicators::MACD(closes);
+    auto smacd = si.getCurrentMACD();
+
+    bool ok = approxEqual(si.getCurrentSMA(20), TechnicalIndicators::SMA(closes, 20)) &&
+              approxEqual(si.getCurrentEMA(10), TechnicalIndicators::EMA(closes, 10)) &&
+              approxEqual(si.getCurrentRSI(14), TechnicalIndicators::RSI(closes, 14)) &&
+              approxEqual(si.getCurrentATR(14), TechnicalIndicators::ATR(candles, 14)) &&
+              approxEqual(si.getCurrentVWAP(), TechnicalIndicators::VWAP(candles)) &&
+              approxEqual(sbb.upper, bb.upper) && approxEqual(sbb.lower, bb.lower) &&
+              approxEqual(smacd.macd, macd.macd) && approxEqual(smacd.signal, macd.signal) &&
+              smacd.bullishCross == macd.bullishCross;
+
+    // 등록하지 않은 기간은 조회만으로 계산되지 않음 (준비 전 값)
+    ok = ok && si.getCurrentSMA(30) == 0.0 && si.getCurrentEMA(30) == 0.0 &&
+         si.getCurrentRSI(9) == 50.0 && si.getCurrentATR(9) == 0.0 &&
+         si.getCurrentBB(30, 2.0).middle == 0.0 && si.getCurrentMACD(5, 35, 5).macd == 0.0;
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("Streaming values differ from batch calculation");
+    }
+}
+
+void testBatchIndicators() {
+    TEST("Batch Indicators");
+
+    // 레인 폭으로 나누어떨어지지 않는 종목 수로 잔여 처리까지 확인
+    const size_t numSymbols = 7;
+    const size_t numBars = 80;
+    std::vector<std::vector<OHLCV>> series(numSymbols);
+    for (size_t s = 0; s < numSymbols; s++) {
+        for (size_t i = 0; i < numBars; i++) {
+            OHLCV c;
+            c.open = 10000.0 * (s + 1) + std::sin((i + s) * 0.4) * 300;
+            c.close = c.open + std::cos(i * 0.9 + s) * 120;
+            c.high = (std::max)(c.open, c.close) + 50;
+            c.low = (std::min)(c.open, c.close) - 50;
+            c.volume = 1000;
+            c.timestamp = i * 60000LL;
+            series[s].push_back(c);
+        }
+    }
+
+    CandleBlock block;
+    block.resize(numSymbols, numBars);
+    for (size_t s = 0; s < numSymbols; s++) {
+        block.setSeries(s, series[s]);
+    }
+
+    std::vector<double> sma, ema, rsi, atr;
+    BatchBands bands;
+    BatchIndicators::SMA(block, 20, sma);
+    BatchIndicators::EMA(block, 12, ema);
+    BatchIndicators::RSI(block, 14, rsi);
+    BatchIndicators::ATR(block, 14, atr);
+    BatchIndicators::BollingerBand(block, 20, 2.0, bands);
+
+    bool ok = std::isnan(sma[block.index(18, 0)]);
+    for (size_t s = 0; s < numSymbols && ok; s++) {
+        std::vector<double> closes;
+        for (const auto& c : series[s]) closes.push_back(c.close);
+
+        size_t last = block.index(numBars - 1, s);
+        auto bb = TechnicalIndicators::BollingerBand(closes, 20, 2.0);
+
+        ok = approxEqual(sma[last], TechnicalIndicators::SMA(closes, 20)) &&
+             approxEqual(ema[last], TechnicalIndicators::EMA(closes, 12)) &&
+             approxEqual(rsi[last], TechnicalIndicators::RSI(closes, 14)) &&
+             approxEqual(atr[last], TechnicalIndicators::ATR(series[s], 14)) &&
+             approxEqual(bands.upper[last], bb.upper) &&
+             approxEqual(bands.lower[last], bb.lower);
+    }
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("Batch values differ from per-symbol calculation (" << BatchIndicators::backendName() << ")");
+    }
+}
+
+void testBatchIndicatorsShortSeries() {
+    TEST("Batch Indicators (short series)");
+
+    // 레인 묶음 안에서 길이가 섞인 경우(스칼라 대체)와 묶음 전체가 짧은 경우(벡터) 모두 포함
+    const size_t lengths[] = {80, 80, 50, 80, 30, 30, 30, 30, 45};
+    const size_t numSymbols = sizeof(lengths) / sizeof(lengths[0]);
+    const size_t numBars = 80;
+
+    CandleBlock block;
+    block.resize(numSymbols, numBars);
+    std::vector<std::vector<OHLCV>> series(numSymbols);
+    for (size_t s = 0; s < numSymbols; s++) {
+        for (size_t i = 0; i < lengths[s]; i++) {
+            OHLCV c;
+            c.open = 10000.0 * (s + 1) + std::sin((i + s) * 0.4) * 300;
+            c.close = c.open + std::cos(i * 0.9 + s) * 120;
+            c.high = (std::max)(c.open, c.close) + 50;
+            c.low = (std::min)(c.open, c.close) - 50;
+            c.volume = 1000;
+            c.timestamp = i * 60000LL;
+            series[s].push_back(c);
+        }
+        block.setSeries(s, series[s]);
+    }
+
+    std::vector<double> sma, ema, rsi, atr;
+    BatchBands bands;
+    BatchIndicators::SMA(block, 20, sma);
+    BatchIndicators::EMA(block, 12, ema);
+    BatchIndicators::RSI(block, 14, rsi);
+    BatchIndicators::ATR(block, 14, atr);
+    BatchIndicators::BollingerBand(block, 20, 2.0, bands);
+
+    // 종목 자기 시리즈의 xxxVector와 첫 값부터 끝까지 비교 (첫 값은 첫 유효 봉 + warmup 위치)
+    auto matches = [&](const std::vector<double>& batch, size_t s, size_t warmup,
+                       const std::vector<double>& expected) {
+        size_t first = block.firstValidBar(s);
+        if (first + warmup + expected.size() != numBars) return false;
+        if (!std::isnan(batch[block.index(first + warmup - 1, s)])) return false;
+        for (size_t i = 0; i < expected.size(); i++) {
+            if (!approxEqual(batch[block.index(first + warmup + i, s)], expected[i])) return false;
+        }
+        return true;
+    };
+
+    bool ok = true;
+    for (size_t s = 0; s < numSymbols && ok; s++) {
+        std::vector<double> closes;
+        for (const auto& c : series[s]) closes.push_back(c.close);
+
+        auto bb = TechnicalIndicators::BollingerBandVector(closes, 20, 2.0);
+        std::vector<double> upper, lower;
+        for (const auto& b : bb) {
+            upper.push_back(b.upper);
+            lower.push_back(b.lower);
+        }
+
+        ok = block.firstValidBar(s) == numBars - lengths[s] &&
+             matches(sma, s, 19, TechnicalIndicators::SMAVector(closes, 20)) &&
+             matches(ema, s, 11, TechnicalIndicators::EMAVector(closes, 12)) &&
+             matches(rsi, s, 14, TechnicalIndicators::RSIVector(closes, 14)) &&
+             matches(atr, s, 14, TechnicalIndicators::ATRVector(series[s], 14)) &&
+             matches(bands.upper, s, 19, upper) &&
+             matches(bands.lower, s, 19, lower);
+    }
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("Short series differ from per-symbol calculation (" << BatchIndicators::backendName() << ")");
+    }
+}
+
+void testRingBuffer() {
+    TEST("Ring Buffer");
+
+    RingBuffer<int> ring(5);
+    for (int i = 1; i <= 8; i++) {
+        ring.push(i);
+    }
+
+    // 용량 5, 8개 입력 → 4..8 보관, 끝에서 감겨 두 구간으로 나뉨
+    auto view = ring.latest(4);
+    std::vector<int> copied;
+    view.copyTo(copied);
+
+    bool ok = ring.size() == 5 && ring[0] == 4 && ring.back() == 8 &&
+              view.size() == 4 && !view.second.empty() &&
+              copied == std::vector<int>({5, 6, 7, 8}) &&
+              ring.latest(100).size() == 5;
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("Unexpected ring buffer contents");
+    }
+}
+
+void testCandleAggregation() {
+    TEST("Multi-Timeframe Candle Aggregation");
+
+    MarketDataManager dm;
+    dm.setDefaultTimeframes({3, 15});
+    dm.addWatchlist("TEST01");
+
+    // 20초 간격 시세 30분 + 다음 분 첫 시세 (누적 거래량 10씩 증가)
+    long long baseTime = 1704067200000LL;
+    for (int k = 0; k <= 90; k++) {
+        QuoteData q;
+        q.code = "TEST01";
+        q.currentPrice = 10000.0 + (k % 7) * 10 - (k % 3) * 5;
+        q.volume = 1000 + k * 10;
+        q.timestamp = baseTime + k * 20000LL;
+        dm.processQuote(q);
+    }
+
+    auto m1 = dm.getMinuteCandles("TEST01", 1, 100);
+    auto m3 = dm.getMinuteCandles("TEST01", 3, 100);
+    auto m15 = dm.getMinuteCandles("TEST01", 15, 100);
+
+    bool ok = m1.size() == 30 && m3.size() == 10 && m15.size() == 2 &&
+              dm.getMinuteCandles("TEST01", 10, 100).empty();
+
+    // 3분봉 = 1분봉 3개 합산
+    for (size_t i = 0; ok && i < m3.size(); i++) {
+        const OHLCV* src = &m1[i * 3];
+        long long volume = src[0].volume + src[1].volume + src[2].volume;
+        double high = (std::max)(src[0].high, (std::max)(src[1].high, src[2].high));
+        ok = m3[i].timestamp == src[0].timestamp && m3[i].open == src[0].open &&
+             m3[i].close == src[2].close && m3[i].high == high && m3[i].volume == volume;
+    }
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("Rolled-up candles do not match 1-minute bars (" << m1.size() << "/"
+             << m3.size() << "/" << m15.size() << ")");
+    }
+}
+
+void testIngestQueue() {
+    TEST("SPSC Ingest Queue");
+
+    // 용량 초과 시 버림, 순서 보존
+    SPSCQueue<int> queue(4);
+    bool ok = queue.tryPush(1) && queue.tryPush(2) && queue.tryPush(3) &&
+              queue.tryPush(4) && !queue.tryPush(5) && queue.size() == 4;
+
+    int value = 0;
+    ok = ok && queue.tryPop(value) && value == 1 && queue.tryPush(5);
+
+    // 모의 피드 → 수신 큐 → 분봉 집계
+    YuantaAPI api;
+    api.initialize();
+    api.connect();
+
+    MarketDataManager dm;
+    dm.setAPI(&api);
+    dm.addWatchlist("005930");
+    dm.startRealtime();
+    std::this_thread::sleep_for(std::chrono::milliseconds(350));
+    dm.stopRealtime();
+
+    auto stats = dm.getIngestStats();
+    // 호가도 수신 스레드가 호가 큐에서 꺼내 반영
+    ok = ok && stats.enqueued > 0 && stats.processed == stats.enqueued &&
+         stats.depth == 0 && stats.orderbookDropped == 0 && dm.getQuote("005930").currentPrice > 0 &&
+         dm.getOrderbook("005930").askPrices[0] > dm.getOrderbook("005930").bidPrices[0];
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("enqueued " << stats.enqueued << ", processed " << stats.processed);
+    }
+}
+
+void testSeqLockSnapshot() {
+    TEST("SeqLock Snapshot");
+
+    // 작성자가 모든 필드를 같은 값으로 기록하는 동안 읽기는 항상 일관된 값을 봐야 함
+    struct Snapshot { long long a, b, c, d; };
+    SeqLock<Snapshot> slot;
+    Snapshot initial{0, 0, 0, 0};
+    Snapshot out{};
+    bool ok = !slot.load(out);
+    slot.store(initial);
+
+    std::atomic<bool> done{false};
+    std::thread writer([&]() {
+        for (long long i = 1; i <= 200000; i++) {
+            slot.store(Snapshot{i, i, i, i});
+        }
+        done = true;
+    });
+
+    long long reads = 0;
+    while (!done || reads < 1000) {
+        Snapshot snap{};
+        if (!slot.load(snap) || snap.a != snap.b || snap.b != snap.c || snap.c != snap.d) {
+            ok = false;
+            break;
+        }
+        reads++;
+    }
+    writer.join();
+
+    ok = ok && slot.load(out) && out.a == 200000 && slot.version() == 200001;
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("Torn or missing snapshot read");
+    }
+}
+
+void testBarFile() {
+    TEST("Binary Bar File");
+
+    // CSV → .ybar 변환 후 매핑된 컬럼이 원본과 같은지 확인
+    const std::string csvPath = "test_bars.csv";
+    const std::string binPath = "test_bars.ybar";
+    {
+        std::ofstream csv(csvPath);
+        csv << "timestamp,open,high,low,close,volume\n";
+        for (int i = 0; i < 50; i++) {
+            csv << (1704067200000LL + i * 60000LL) << "," << (100.0 + i) << ","
+                << (101.5 + i) << "," << (99.25 + i) << "," << (100.5 + i) << ","
+                << (1000 + i) << "\n";
+        }
+    }
+
+    HistoricalDataLoader loader;
+    std::vector<OHLCV> fromCsv;
+    bool ok = loader.loadFromCSV(csvPath, fromCsv) &&
+              loader.convertCSVToBinary({{"005930", csvPath}, {"000660", csvPath}}, binPath);
+
+    BarFileReader reader;
+    BarSeriesView view;
+    ok = ok && reader.open(binPath) && reader.symbolCount() == 2 &&
+         reader.totalBars() == 100 && reader.find("000660", view) &&
+         view.count == fromCsv.size() && !reader.find("999999", view);
+
+    ok = ok && reader.find("005930", view);
+    for (size_t i = 0; ok && i < view.count; i++) {
+        OHLCV bar = view.at(i);
+        ok = bar.timestamp == fromCsv[i].timestamp && bar.open == fromCsv[i].open &&
+             bar.high == fromCsv[i].high && bar.low == fromCsv[i].low &&
+             bar.close == fromCsv[i].close && bar.volume == fromCsv[i].volume;
+    }
+    reader.close();
+
+    std::vector<OHLCV> fromBinary;
+    ok = ok && loader.loadFromBinary(binPath, "000660", fromBinary) &&
+         fromBinary.size() == 50 && fromBinary.back().close == 149.5;
+
+    std::remove(csvPath.c_str());
+    std::remove(binPath.c_str());
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("Binary bars differ from CSV source");
+    }
+}
+
+void testCSVParser() {
+    TEST("CSV Bar Parser");
+
+    // 헤더, CRLF, 빈 줄, 형식 오류 행, 마지막 줄 개행 없음
+    const std::string text =
+        "timestamp,open,high,low,close,volume\r\n"
+        "1704067200000,100.5,101,99.75,100.25,1200\r\n"
+        "\r\n"
+        "1704067260000,100.25,abc,99.5,100,900\n"
+        "1704067320000,100,100.5,99\n"
+        "1704067380000,1e2,100.5,99.5,100.125,-3,extra\n"
+        "1704067440000,101,102,100,101.5,1500";
+
+    std::vector<OHLCV> candles;
+    CSVParseResult result;
+    CSVBarParser::parseBuffer(text.data(), text.data() + text.size(), candles, result);
+
+    bool ok = result.rows == 3 && candles.size() == 3 && result.malformed == 2 &&
+              result.malformedLines.size() == 2 &&
+              result.malformedLines[0] == 4 && result.malformedLines[1] == 5;
+
+    ok = ok && candles[0].timestamp == 1704067200000LL && candles[0].open == 100.5 &&
+         candles[0].low == 99.75 && candles[0].volume == 1200 &&
+         candles[1].open == 100.0 && candles[1].close == 100.125 && candles[1].volume == -3 &&
+         candles[2].close == 101.5 && candles[2].volume == 1500;
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("Rows=" << result.rows << " malformed=" << result.malformed);
+    }
+}
+
+void testHistoryWarmUp() {
+    TEST("Parallel History Warm-up");
+
+    // 종목 12개를 바이너리 봉 파일로 만든 뒤 3개 스레드로 워밍업
+    const std::string binPath = "test_warmup.ybar";
+    std::vector<std::string> codes;
+    {
+        BarFileWriter writer;
+        writer.open(binPath);
+        for (int s = 0; s < 12; s++) {
+            std::string code = "W" + std::to_string(100000 + s).substr(1);
+            codes.push_back(code);
+
+            std::vector<OHLCV> bars;
+            for (int i = 0; i < 30; i++) {
+                OHLCV bar;
+                bar.timestamp = 1704067200000LL + i * 60000LL;
+                bar.open = bar.high = bar.low = bar.close = 1000.0 * (s + 1) + i;
+                bar.volume = 10;
+                bars.push_back(bar);
+            }
+            writer.addSeries(code, bars);
+        }
+        writer.finish();
+    }
+
+    BarFileReader reader;
+    MarketDataManager manager;
+    manager.addWatchlist(codes[0]);
+    manager.registerTimeframe(codes[0], 3);
+
+    size_t loaded = reader.open(binPath) ?
+        manager.warmUpHistory(codes, 20, &reader, 3) : 0;
+
+    bool ok = loaded == codes.size();
+    for (size_t s = 0; ok && s < codes.size(); s++) {
+        auto bars = manager.getMinuteCandles(codes[s], 1, 100);
+        ok = bars.size() == 30 && bars.back().close == 1000.0 * (s + 1) + 29;
+    }
+
+    // 워밍업 전에 종목에 등록한 주기는 유지
+    auto timeframes = manager.getTimeframes(codes[0]);
+    ok = ok && std::find(timeframes.begin(), timeframes.end(), 3) != timeframes.end() &&
+         manager.getMinuteCandles(codes[0], 3, 100).size() == 9;
+
+    reader.close();
+    std::remove(binPath.c_str());
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("Loaded " << loaded << " of " << codes.size() << " symbols");
+    }
+}
+
+void testBarIndex() {
+    TEST("Bar Range / Day Index");
+
+    // 3거래일 × 390분 (KST 09:00 = UTC 00:00), 2024-01-02부터
+    const long long day0 = 1704153600000LL;
+    std::vector<OHLCV> bars;
+    for (int d = 0; d < 3; d++) {
+        for (int m = 0; m < 390; m++) {
+            OHLCV bar;
+            bar.timestamp = day0 + d * DayIndex::DAY_MS + m * 60000LL;
+            bar.close = d * 1000 + m;
+            bars.push_back(bar);
+        }
+    }
+
+    HistoricalDataLoader loader;
+    long long from = bars[100].timestamp;
+    long long to = bars[899].timestamp;
+    Span<OHLCV> range = loader.sliceByDate(bars, from, to);
+    std::vector<OHLCV> copied = loader.filterByDate(bars, from, to);
+
+    bool ok = range.size() == 800 && range.data() == &bars[100] &&
+              copied.size() == 800 && copied.back().close == range.back().close &&
+              loader.sliceByDate(bars, to, from).empty() &&
+              loader.sliceByDate(bars, from + 1, from + 59999).empty();
+
+    DayIndex index(bars);
+    ok = ok && index.dayCount() == 3 &&
+         index.day(1).begin == 390 && index.day(1).end == 780 &&
+         index.dayBars(2).front().close == 2000 &&
+         index.dayRange(1, 5).size() == 780 &&
+         index.findDay(bars[500].timestamp) == 1 &&
+         index.findDay(day0 + 5 * DayIndex::DAY_MS) == DayIndex::npos &&
+         DayIndex::dayStart(bars[389].timestamp) == day0 - DayIndex::KST_OFFSET_MS;
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("Range size " << range.size() << ", days " << index.dayCount());
+    }
+}
+
+void testThreadPool() {
+    TEST("Work-Stealing Thread Pool");
+
+    bool ok = true;
+    long long executed = 0;
+    {
+        ThreadPool pool(4);
+
+        // 작업 안에서 다시 제출한 작업(자기 대기열)과 외부 제출 작업을 섞어 실행
+        std::atomic<long long> sum{0};
+        std::vector<std::future<int>> futures;
+        for (int i = 0; i < 200; i++) {
+            futures.push_back(pool.submit([&pool, &sum, i]() {
+                pool.submit([&sum, i]() { sum += i; });
+                return i * 2;
+            }));
+        }
+
+        // 결과는 제출 순서대로 받음
+        for (int i = 0; i < 200; i++) {
+            ok = ok && futures[i].get() == i * 2;
+        }
+
+        // 예외는 future로 전달
+        auto failing = pool.submit([]() -> int { throw std::runtime_error("job failed"); });
+        bool thrown = false;
+        try {
+            failing.get();
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        ok = ok && thrown && pool.size() == 4;
+
+        // 소멸 시 남은 작업까지 처리
+        auto last = pool.submit([&sum]() { return sum.load(); });
+        last.get();
+        while (sum.load() != 199 * 200 / 2 && pool.getExecutedCount() < 402) {
+            std::this_thread::yield();
+        }
+        ok = ok && sum.load() == 199 * 200 / 2;
+        executed = pool.getExecutedCount();
+    }
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("Executed " << executed << " tasks");
+    }
+}
+
+bool sameSeries(Span<double> a, Span<double> b) {
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+}
+
+void testIndicatorContextView() {
+    TEST("Indicator Context View");
+
+    // 긴 시리즈의 구간 뷰로 만든 컨텍스트가 복사본 컨텍스트와 같은 지표를 내는지 확인
+    std::vector<OHLCV> series;
+    std::vector<double> closes;
+    for (int i = 0; i < 300; i++) {
+        OHLCV bar;
+        bar.close = 100.0 + std::sin(i * 0.1) * 5.0;
+        bar.open = bar.high = bar.low = bar.close;
+        bar.volume = 1000;
+        bar.timestamp = 1704067200000LL + i * 60000LL;
+        series.push_back(bar);
+        closes.push_back(bar.close);
+    }
+
+    Span<OHLCV> window = Span<OHLCV>(series).subspan(150, 101);
+    std::vector<OHLCV> copied(window.begin(), window.end());
+
+    IndicatorContext view("005930", 1, window, Span<double>(closes).subspan(150, 101));
+    IndicatorContext owned("005930", 1, copied);
+    IndicatorContext extracted("005930", 1, window);
+
+    // 종목 ID를 미리 받은 뷰는 레지스트리를 거치지 않고 같은 ID를 가짐
+    SymbolId id = SymbolRegistry::instance().intern("005930");
+    IndicatorContext withId("005930", id, 1, window, Span<double>(closes).subspan(150, 101));
+
+    bool ok = view.getCandles().data() == &series[150] &&
+              withId.getSymbolId() == view.getSymbolId() &&
+              withId.getCloses().data() == &closes[150] &&
+              sameSeries(withId.sma(20), view.sma(20)) &&
+              view.getCloses().data() == &closes[150] &&
+              extracted.getCloses().size() == 101 &&
+              sameSeries(view.sma(20), owned.sma(20)) && sameSeries(view.rsi(14), owned.rsi(14)) &&
+              sameSeries(extracted.ema(10), owned.ema(10)) &&
+              view.bollinger(20, 2.0).size() == owned.bollinger(20, 2.0).size() &&
+              approxEqual(view.bollinger(20, 2.0).back().upper, owned.bollinger(20, 2.0).back().upper, 1e-12);
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("View context differs from copied context");
+    }
+}
+
+void testIndicatorColumns() {
+    TEST("Indicator Columns");
+
+    // 전 구간 컬럼에서 잘라 읽은 값이 lookback 구간으로 직접 계산한 값과 같은 정렬인지 확인
+    std::vector<OHLCV> series;
+    std::vector<double> closes;
+    for (int i = 0; i < 500; i++) {
+        OHLCV bar;
+        bar.close = 100.0 + std::sin(i * 0.07) * 8.0 + (i % 5) * 0.3;
+        bar.open = bar.close - 0.2;
+        bar.high = bar.close + 0.5;
+        bar.low = bar.close - 0.6;
+        bar.volume = 1000 + i;
+        bar.timestamp = 1704067200000LL + i * 60000LL;
+        series.push_back(bar);
+        closes.push_back(bar.close);
+    }
+
+    IndicatorColumns columns(series, closes, {
+        IndicatorKey{IndicatorType::SMA, 20},
+        IndicatorKey{IndicatorType::RSI, 14},
+        IndicatorKey{IndicatorType::ATR, 14},
+        IndicatorKey{IndicatorType::BOLLINGER, 20, 0, 0, 2.0},
+        IndicatorKey{IndicatorType::MACD, 12, 26, 9}
+    });
+    bool supportsVWAP = columns.add(IndicatorKey{IndicatorType::VWAP});
+
+    bool ok = columns.size() == 5 && !supportsVWAP;
+    for (size_t end = 101; end <= series.size() && ok; end += 37) {
+        size_t begin = end - 101;
+        Span<OHLCV> window = Span<OHLCV>(series).subspan(begin, 101);
+        Span<double> windowCloses = Span<double>(closes).subspan(begin, 101);
+
+        IndicatorContext direct("005930", 1, window, windowCloses);
+        IndicatorContext fromColumns("005930", 1, window, windowCloses, &columns, begin);
+
+        Span<double> sma = fromColumns.sma(20);
+        Span<BollingerBands> bands = fromColumns.bollinger(20, 2.0);
+        ok = sma.size() == direct.sma(20).size() &&
+             approxEqual(sma.front(), direct.sma(20).front(), 1e-9) &&
+             approxEqual(sma.back(), direct.sma(20).back(), 1e-9) &&
+             fromColumns.rsi(14).size() == direct.rsi(14).size() &&
+             fromColumns.atr(14).size() == direct.atr(14).size() &&
+             bands.size() == direct.bollinger(20, 2.0).size() &&
+             approxEqual(bands.back().upper, direct.bollinger(20, 2.0).back().upper, 1e-9) &&
+             sameSeries(fromColumns.vwap(), direct.vwap());
+
+        // 재귀 지표는 시드 차이만 남는다 (lookback 101봉이면 충분히 수렴)
+        ok = ok && approxEqual(fromColumns.rsi(14).back(), direct.rsi(14).back(), 0.5) &&
+             approxEqual(fromColumns.macd().macd, direct.macd().macd, 0.05);
+    }
+
+    // 봉 위치에 맞는 값인지 (끝이 end-1번째 봉)
+    Span<double> tail = IndicatorContext("005930", 1, Span<OHLCV>(series).subspan(399, 101),
+                                         Span<double>(closes).subspan(399, 101),
+                                         &columns, 399).sma(20);
+    double expected = 0.0;
+    for (size_t i = 480; i < 500; ++i) expected += closes[i];
+    ok = ok && approxEqual(tail.back(), expected / 20, 1e-9);
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("Column views differ from windowed indicators");
+    }
+}
+
+void testBatchPrecompute() {
+    TEST("Batch Precompute at Bar Close");
+
+    // 길이가 다른 두 종목을 일괄 계산해 게시하고, 같은 봉으로 조회하면 그 컨텍스트가 재사용되는지
+    StrategyManager manager;
+    manager.addStrategy(std::make_unique<MABreakoutStrategy>());
+    manager.addStrategy(std::make_unique<BBSqueezeStrategy>());
+
+    std::vector<std::string> codes = {"005930", "000660"};
+    std::vector<std::vector<OHLCV>> candles(2);
+    const size_t lengths[] = {100, 60};
+    for (size_t s = 0; s < 2; s++) {
+        for (size_t i = 0; i < lengths[s]; i++) {
+            OHLCV bar;
+            bar.close = 50000.0 * (s + 1) + std::sin(i * 0.3 + s) * 400.0;
+            bar.open = bar.close - 30;
+            bar.high = bar.close + 80;
+            bar.low = bar.close - 90;
+            bar.volume = 1000 + i;
+            bar.timestamp = 1704067200000LL + i * 60000LL;
+            candles[s].push_back(bar);
+        }
+    }
+
+    bool ok = manager.precomputeIndicators(codes, candles) == 2 &&
+              manager.getIndicatorCache().size() == 2;
+
+    for (size_t s = 0; s < 2 && ok; s++) {
+        auto published = manager.getIndicatorCache().getContext(codes[s], 1, candles[s]);
+        auto again = manager.getIndicatorCache().getContext(codes[s], 1, candles[s]);
+        ok = published == again;
+
+        IndicatorContext direct(codes[s], 1, candles[s]);
+        Span<BollingerBands> bands = published->bollinger(20, 2.0);
+        Span<BollingerBands> expectedBands = direct.bollinger(20, 2.0);
+        ok = ok && !published->sma(20).empty() &&
+             published->sma(20).size() == direct.sma(20).size() &&
+             approxEqual(published->sma(20).front(), direct.sma(20).front(), 1e-6) &&
+             approxEqual(published->sma(20).back(), direct.sma(20).back(), 1e-6) &&
+             published->rsi(14).size() == direct.rsi(14).size() &&
+             approxEqual(published->rsi(14).back(), direct.rsi(14).back(), 1e-6) &&
+             published->atr(14).size() == direct.atr(14).size() &&
+             approxEqual(published->atr(14).back(), direct.atr(14).back(), 1e-6) &&
+             bands.size() == expectedBands.size() &&
+             approxEqual(bands.back().upper, expectedBands.back().upper, 1e-6) &&
+             approxEqual(bands.back().percentB, expectedBands.back().percentB, 1e-6);
+    }
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("Published batch contexts differ from per-symbol indicators");
+    }
+}
+
+// 조건이 참이 될 때까지 대기 (timeoutMs 안에 참이 되면 true)
+template <typename Pred>
+bool waitUntil(Pred pred, int timeoutMs = 2000) {
+    for (int i = 0; i < timeoutMs; i++) {
+        if (pred()) return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return pred();
+}
+
+void testEvaluatorCoalescing() {
+    TEST("Strategy Evaluator Coalescing");
+
+    // 평가 전 같은 종목 알림은 대기 플래그로 한 번에 합쳐지고 순서는 처음 알림 기준
+    SymbolRegistry::instance().intern("EVAL01");
+    SymbolRegistry::instance().intern("EVAL02");
+
+    std::mutex orderMutex;
+    std::vector<std::string> order;
+    StrategyEvaluator evaluator;
+    evaluator.setHandler([&](const std::string& code) {
+        std::lock_guard<std::mutex> lock(orderMutex);
+        order.push_back(code);
+    });
+
+    evaluator.notify("EVAL01");
+    evaluator.notify("EVAL02");
+    evaluator.notify("EVAL01");
+    evaluator.notify("EVAL01");
+    bool ok = evaluator.getPendingCount() == 2 && evaluator.getCoalescedCount() == 2;
+
+    evaluator.start();
+    ok = ok && waitUntil([&] { return evaluator.getEvaluationCount() == 2; });
+    evaluator.stop();
+
+    std::lock_guard<std::mutex> lock(orderMutex);
+    ok = ok && order.size() == 2 && order[0] == "EVAL01" && order[1] == "EVAL02";
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("evaluated " << order.size() << ", coalesced " << evaluator.getCoalescedCount());
+    }
+}
+
+void testEvaluatorRequeue() {
+    TEST("Strategy Evaluator Requeue");
+
+    // 평가 중에 들어온 같은 종목 알림은 합쳐지지 않고 평가가 끝난 뒤 다시 처리
+    SymbolRegistry::instance().intern("EVAL01");
+
+    std::atomic<int> calls{0};
+    std::atomic<bool> release{false};
+    StrategyEvaluator evaluator;
+    evaluator.setHandler([&](const std::string&) {
+        if (calls++ == 0) {
+            while (!release) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+
+    evaluator.start();
+    evaluator.notify("EVAL01");
+    bool ok = waitUntil([&] { return calls == 1; });
+
+    evaluator.notify("EVAL01");
+    ok = ok && evaluator.getPendingCount() == 1 && evaluator.getCoalescedCount() == 0;
+
+    release = true;
+    ok = ok && waitUntil([&] { return evaluator.getEvaluationCount() == 2; });
+    evaluator.stop();
+    ok = ok && calls == 2;
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("calls " << calls << ", coalesced " << evaluator.getCoalescedCount());
+    }
+}
+
+void testEvaluatorStop() {
+    TEST("Strategy Evaluator Stop");
+
+    // 평가 중 stop: 진행 중인 평가만 끝내고 남은 대기열은 평가하지 않고 비움
+    SymbolRegistry::instance().intern("EVAL01");
+    SymbolRegistry::instance().intern("EVAL02");
+    SymbolRegistry::instance().intern("EVAL03");
+
+    std::atomic<int> calls{0};
+    std::atomic<bool> release{false};
+    StrategyEvaluator evaluator;
+    evaluator.setHandler([&](const std::string&) {
+        if (calls++ == 0) {
+            while (!release) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+
+    evaluator.start();
+    evaluator.notify("EVAL01");
+    bool ok = waitUntil([&] { return calls == 1; });
+    evaluator.notify("EVAL02");
+    evaluator.notify("EVAL03");
+
+    std::atomic<bool> stopped{false};
+    std::thread stopper([&] {
+        evaluator.stop();
+        stopped = true;
+    });
+    ok = ok && waitUntil([&] { return !evaluator.isRunning(); });
+    release = true;
+    stopper.join();
+
+    ok = ok && stopped && calls == 1 && evaluator.getEvaluationCount() == 1 &&
+         evaluator.getPendingCount() == 0;
+
+    // 버린 종목도 재시작 후 알림이 합쳐지지 않고 다시 평가됨
+    evaluator.start();
+    evaluator.notify("EVAL02");
+    ok = ok && waitUntil([&] { return evaluator.getEvaluationCount() == 2; }) &&
+         evaluator.getCoalescedCount() == 0;
+    evaluator.stop();
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("calls " << calls << ", pending " << evaluator.getPendingCount());
+    }
+}
+
+void testStrategyStatusSnapshot() {
+    TEST("Strategy Status Snapshot");
+
+    // 평가 스레드가 분석하는 동안 다른 스레드가 상태 복사본을 읽음
+    StrategyManager manager;
+    manager.addStrategy(std::make_unique<MABreakoutStrategy>());
+    manager.addStrategy(std::make_unique<BBSqueezeStrategy>());
+    manager.getStrategy("BBSqueeze")->setEnabled(false);
+
+    std::vector<OHLCV> candles;
+    for (int i = 0; i < 100; i++) {
+        OHLCV bar;
+        bar.close = 50000.0 + std::sin(i * 0.3) * 400.0;
+        bar.open = bar.close - 30;
+        bar.high = bar.close + 80;
+        bar.low = bar.close - 90;
+        bar.volume = 1000 + i;
+        bar.timestamp = 1704067200000LL + i * 60000LL;
+        candles.push_back(bar);
+    }
+    QuoteData quote;
+    quote.currentPrice = candles.back().close;
+
+    std::atomic<bool> done{false};
+    std::thread analyzer([&] {
+        for (int i = 0; i < 200; i++) {
+            manager.analyzeAll("005930", candles, quote);
+        }
+        done = true;
+    });
+
+    bool ok = true;
+    while (!done && ok) {
+        auto snapshot = manager.getStatusSnapshot();
+        ok = snapshot.size() == 2 && snapshot[0].name == "MABreakout" && snapshot[0].enabled &&
+             snapshot[1].name == "BBSqueeze" && !snapshot[1].enabled &&
+             snapshot[1].signalCount == 0;
+    }
+    analyzer.join();
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("Unexpected strategy status snapshot");
+    }
+}
+
+void testBarStream() {
+    TEST("Merged Bar Stream");
+
+    // 시각이 엇갈리고 길이가 다른 세 시리즈를 병합 (같은 시각은 시리즈 순서)
+    auto makeSeries = [](long long first, long long step, int count) {
+        std::vector<OHLCV> bars;
+        for (int i = 0; i < count; i++) {
+            OHLCV bar;
+            bar.timestamp = first + i * step;
+            bar.open = bar.high = bar.low = bar.close = 100.0 + i;
+            bar.volume = 1000;
+            bars.push_back(bar);
+        }
+        return bars;
+    };
+    std::vector<OHLCV> a = makeSeries(0, 3, 50);
+    std::vector<OHLCV> b = makeSeries(1, 2, 80);
+    std::vector<OHLCV> c = makeSeries(0, 6, 10);
+    std::vector<OHLCV> empty;
+
+    MergedBarStream stream;
+    stream.reserve(4);
+    stream.addSeries(a);
+    stream.addSeries(b, 5);
+    stream.addSeries(empty);
+    stream.addSeries(c);
+
+    bool ok = stream.remaining() == 50 + 75 + 10;
+    size_t seen = 0;
+    long long prevTime = -1;
+    size_t prevSeries = 0;
+    std::vector<size_t> nextIndex = {0, 5, 0, 0};
+    MergedBarStream::Event event;
+    while (stream.next(event)) {
+        const std::vector<OHLCV>& src = event.series == 0 ? a : (event.series == 1 ? b : c);
+        ok = ok && event.bar == &src[event.index] &&
+             event.index == nextIndex[event.series]++ &&
+             (event.bar->timestamp > prevTime ||
+              (event.bar->timestamp == prevTime && event.series > prevSeries));
+        prevTime = event.bar->timestamp;
+        prevSeries = event.series;
+        seen++;
+    }
+
+    long long t;
+    ok = ok && seen == 135 && stream.empty() && !stream.peekTime(t) && nextIndex[2] == 0;
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("Merged " << seen << " bars out of order");
+    }
+}
+
+void testClockService() {
+    TEST("Clock Service");
+
+    // 2024-01-01 00:00 UTC = 월요일 09:00 KST
+    const long long mondayOpen = 1704067200000LL;
+    const long long dayMs = 24LL * 60 * 60 * 1000;
+
+    SessionTime open = SessionTime::fromEpochMs(mondayOpen);
+    SessionTime saturday = SessionTime::fromEpochMs(mondayOpen + 5 * dayMs + 60 * 60000);
+    SessionTime late = SessionTime::fromEpochMs(mondayOpen + 330 * 60000 + 59999);
+    bool ok = open.minuteOfDay == 540 && open.weekday == 1 && open.isMarketHours() &&
+              saturday.weekday == 6 && saturday.minuteOfDay == 600 && !saturday.isMarketHours() &&
+              late.minuteOfDay == SessionTime::TIME_STOP && late.minutesSinceOpen() == 330 &&
+              SessionTime::unpack(late.pack()).minuteOfDay == late.minuteOfDay;
+
+    // 모의 시계를 설치하면 장 시간 판단이 모의 시각을 따르고, 범위를 벗어나면 복원됨
+    MarketDataManager manager;
+    SimulatedClock simulated(mondayOpen);
+    const Clock* outside = &currentClock();
+    bool otherThreadSystem = false;
+    {
+        ScopedClock scope(simulated);
+        ok = ok && &currentClock() == &simulated && manager.isMarketOpen() &&
+             manager.getMinutesSinceOpen() == 0;
+
+        simulated.advance(45 * 60000);
+        ok = ok && manager.getMinutesSinceOpen() == 45;
+
+        simulated.set(mondayOpen + 5 * dayMs);
+        ok = ok && !manager.isMarketOpen();
+
+        // 교체는 현재 스레드에만 적용
+        std::thread other([&]() { otherThreadSystem = &currentClock() == outside; });
+        other.join();
+    }
+    ok = ok && otherThreadSystem && &currentClock() == outside;
+
+    // 시스템 시계의 캐시된 장중 시각은 직접 계산한 값과 일치
+    const Clock& system = currentClock();
+    SessionTime cached = system.session();
+    SessionTime direct = SessionTime::fromEpochMs(system.nowMs());
+    ok = ok && (cached.minuteOfDay == direct.minuteOfDay ||
+                (cached.minuteOfDay + 1) % 1440 == direct.minuteOfDay);
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("Session time did not follow the installed clock");
+    }
+}
+
 int main() {
     std::cout << "========================================" << std::endl;
     std::cout << "  Technical Indicators Test Suite" << std::endl;
@@ -169,6 +1196,27 @@ int main() {
     testATR();
     testVWAP();
     testMAAlignment();
+    testStreamingIndicators();
+    testBatchIndicators();
+    testBatchIndicatorsShortSeries();
+    testRingBuffer();
+    testCandleAggregation();
+    testIngestQueue();
+    testSeqLockSnapshot();
+    testBarFile();
+    testCSVParser();
+    testHistoryWarmUp();
+    testBarIndex();
+    testThreadPool();
+    testIndicatorContextView();
+    testIndicatorColumns();
+    testBatchPrecompute();
+    testEvaluatorCoalescing();
+    testEvaluatorRequeue();
+    testEvaluatorStop();
+    testStrategyStatusSnapshot();
+    testBarStream();
+    testClockService();
 
     std::cout << "\n========================================" << std::endl;
     if (failures == 0) {